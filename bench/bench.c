@@ -0,0 +1,253 @@
+// micro-benchmarks for the software rasterizer in src/server/wm.c
+//
+// usage: bench [seconds per case]
+// SQWS_BLEND=scalar|sse2 runs the blend cases on the slower kernels
+// prints one JSON document to stdout, progress goes to stderr
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "wm.h"
+#include "draw.h"
+#include "fonts.h"
+#include "sqwsproto.h"
+
+drmModeModeInfo mode;
+
+#define MAX_SAMPLES 100000
+
+static double min_time = 0.5;
+static double samples[MAX_SAMPLES];
+static bool first_case = true;
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, int n, double p) {
+    int i = (int)(p * (n - 1) + 0.5);
+    return sorted[i];
+}
+
+typedef struct {
+    unsigned char *buf;
+    int pitch, sw, sh;
+    int windows;
+} bench_ctx_t;
+
+typedef void (*bench_fn)(const bench_ctx_t *ctx);
+
+// runs fn until min_time has passed and reports per-call statistics,
+// pixels is how many pixels one call touches
+static void run_case(const char *name, bench_fn fn, const bench_ctx_t *ctx, double pixels) {
+    fn(ctx); // warm up caches and fault in pages
+
+    int n = 0;
+    double start = now_s(), total = 0;
+    while (n < MAX_SAMPLES && (total < min_time || n < 5)) {
+        double t0 = now_s();
+        fn(ctx);
+        double t1 = now_s();
+        samples[n++] = t1 - t0;
+        total = t1 - start;
+    }
+    qsort(samples, n, sizeof(double), cmp_double);
+
+    double sum = 0;
+    for (int i = 0; i < n; i++) sum += samples[i];
+    double mean = sum / n;
+    double median = percentile(samples, n, 0.5);
+
+    printf("%s\n    {\"name\": \"%s\", \"width\": %d, \"height\": %d, \"windows\": %d, "
+           "\"iterations\": %d, \"pixels\": %.0f, \"ns_per_pixel\": %.4f, \"mpix_per_s\": %.2f, "
+           "\"frame_ms\": {\"mean\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f}}",
+           first_case ? "" : ",", name, ctx->sw, ctx->sh, ctx->windows, n, pixels,
+           median * 1e9 / pixels, pixels / median * 1e-6,
+           mean * 1e3, median * 1e3, percentile(samples, n, 0.9) * 1e3,
+           percentile(samples, n, 0.99) * 1e3, samples[n - 1] * 1e3);
+    fflush(stdout);
+    first_case = false;
+    fprintf(stderr, "%-22s %5dx%-5d %2d windows  %8.3f ms  %8.1f MPix/s\n",
+            name, ctx->sw, ctx->sh, ctx->windows, median * 1e3, pixels / median * 1e-6);
+}
+
+static const unsigned char opaque_color[4] = {50, 120, 200, 255};
+static const unsigned char alpha_color[4] = {0, 200, 255, 200};
+static const char text_line[] = "The quick brown fox jumps over the lazy dog 0123456789";
+static const char text_line_utf8[] = "Съешь же ещё этих мягких французских булок, Ξεσκεπάζω";
+
+static void bench_put_pixel(const bench_ctx_t *c) {
+    for (int y = 0; y < c->sh; y++)
+        for (int x = 0; x < c->sw; x++)
+            put_pixel(c->buf, x, y, opaque_color, c->pitch, c->sw, c->sh);
+}
+
+static void bench_blend_pixel(const bench_ctx_t *c) {
+    for (int y = 0; y < c->sh; y++) {
+        unsigned char *row = c->buf + y * c->pitch;
+        for (int x = 0; x < c->sw; x++)
+            blend_pixel(row + x * 4, alpha_color);
+    }
+}
+
+static void bench_rect_opaque(const bench_ctx_t *c) {
+    draw_rect(c->buf, 0, 0, c->sw, c->sh, opaque_color, 0, c->pitch, c->sw, c->sh);
+}
+
+static void bench_rect_alpha(const bench_ctx_t *c) {
+    draw_rect(c->buf, 0, 0, c->sw, c->sh, alpha_color, 1, c->pitch, c->sw, c->sh);
+}
+
+static uint32_t *argb_src;
+
+static void bench_blend_span_argb(const bench_ctx_t *c) {
+    for (int y = 0; y < c->sh; y++)
+        blend_span_argb((uint32_t *)(c->buf + y * c->pitch), argb_src + (size_t)y * c->sw, c->sw);
+}
+
+static void bench_blit(const bench_ctx_t *c, int surface_mode) {
+    blit_rect(c->buf, c->pitch, (const unsigned char *)argb_src, c->sw * 4, c->sw, c->sh, surface_mode);
+}
+
+static void bench_blit_opaque(const bench_ctx_t *c) { bench_blit(c, SQWS_SURFACE_OPAQUE); }
+static void bench_blit_alpha_test(const bench_ctx_t *c) { bench_blit(c, SQWS_SURFACE_ALPHA_TEST); }
+static void bench_blit_blend(const bench_ctx_t *c) { bench_blit(c, SQWS_SURFACE_BLEND); }
+
+static void bench_draw_char(const bench_ctx_t *c) {
+    for (int y = 0; y + 16 <= c->sh; y += 16)
+        for (int x = 0; x + 8 <= c->sw; x += 8)
+            draw_char(c->buf, x, y, 'A' + (x / 8 + y / 16) % 26, opaque_color, c->pitch, c->sw, c->sh);
+}
+
+static void draw_text_lines(const bench_ctx_t *c, const char *text) {
+    int width = text_width(text);
+    for (int y = 0; y + 16 <= c->sh; y += 16)
+        for (int x = 0; x + width <= c->sw; x += width)
+            draw_text(c->buf, x, y, text, opaque_color, c->pitch, c->sw, c->sh);
+}
+
+static void bench_draw_text(const bench_ctx_t *c) { draw_text_lines(c, text_line); }
+static void bench_draw_text_utf8(const bench_ctx_t *c) { draw_text_lines(c, text_line_utf8); }
+
+static void bench_draw_window(const bench_ctx_t *c) {
+    window_prepare_decorations();
+    for (int i = window_bottom(); i >= 0; i = window_above(i))
+        draw_window(&windows[i], c->buf, 0, 0, c->pitch, c->sw, c->sh);
+}
+
+static void set_minimized(bool minimized) {
+    for (int i = window_top(); i >= 0; i = window_below(i)) {
+        windows[i].minimized = minimized;
+        window_update_geom(&windows[i]);
+    }
+}
+
+// minimized windows are just their title bars
+static void bench_draw_title_bars(const bench_ctx_t *c) {
+    bench_draw_window(c);
+}
+
+static void bench_redraw_all(const bench_ctx_t *c) {
+    redraw_all(c->buf, c->pitch, c->sw, c->sh);
+}
+
+static double text_pixels(const bench_ctx_t *c, const char *text) {
+    int width = text_width(text);
+    return (double)(c->sh / 16) * (c->sw / width) * width * 16;
+}
+
+// cascades n windows over the screen, each about half the screen in size
+static double setup_windows(int n, int sw, int sh) {
+    free_windows();
+    damage_clear(&screen_damage);
+
+    double area = 0;
+    int w = sw / 2, h = sh / 2;
+    for (int i = 0; i < n; i++) {
+        unsigned char color[4] = {(unsigned char)(i * 37), (unsigned char)(i * 91), 128, 255};
+        int x = n > 1 ? (sw - w) * i / (n - 1) : sw / 4;
+        int y = n > 1 ? (sh - h) * ((i * 7) % n) / (n - 1) : sh / 4;
+        char title[64];
+        snprintf(title, sizeof(title), "window %d", i);
+        int slot = window_alloc();
+        if (slot < 0) break;
+        handle_create(slot, title, x, y, w, h, color);
+        if (i == n - 1) window_focus(slot);
+
+        window_t *win = &windows[slot];
+        for (int p = 0; p < win->canvas_w * win->canvas_h; p++)
+            ((uint32_t *)win->canvas)[p] = 0xff000000u | (p * 2654435761u >> 8);
+        win->drawn = true;
+        area += (double)win->w * win->h;
+    }
+    return area;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) min_time = atof(argv[1]);
+
+    static const struct { int w, h; } resolutions[] = { {1920, 1080}, {3840, 2160} };
+    static const int window_counts[] = { 1, 8, 64 };
+
+    blend_init();
+    if (!font_init() || !compose_init()) return 1;
+    printf("{\n  \"benchmark\": \"sqws-rasterizer\",\n  \"blend_kernel\": \"%s\",\n  \"threads\": %d,\n  \"min_time_s\": %.3f,\n  \"cases\": [",
+           blend_kernel_name(), compose_threads(), min_time);
+
+    for (size_t r = 0; r < sizeof(resolutions) / sizeof(resolutions[0]); r++) {
+        int sw = resolutions[r].w, sh = resolutions[r].h;
+        mode.hdisplay = sw;
+        mode.vdisplay = sh;
+
+        bench_ctx_t ctx = { .pitch = sw * 4, .sw = sw, .sh = sh, .windows = 0 };
+        ctx.buf = calloc(1, (size_t)ctx.pitch * sh);
+        if (!ctx.buf) { perror("calloc"); return 1; }
+        double screen = (double)sw * sh;
+
+        // translucent source with a mix of clear, opaque and partial alpha
+        argb_src = malloc((size_t)sw * sh * 4);
+        if (!argb_src) { perror("malloc"); return 1; }
+        for (size_t p = 0; p < (size_t)sw * sh; p++)
+            argb_src[p] = (uint32_t)(p * 2654435761u) ^ (uint32_t)(p << 13);
+
+        run_case("put_pixel", bench_put_pixel, &ctx, screen);
+        run_case("blend_pixel", bench_blend_pixel, &ctx, screen);
+        run_case("draw_rect_opaque", bench_rect_opaque, &ctx, screen);
+        run_case("draw_rect_alpha", bench_rect_alpha, &ctx, screen);
+        run_case("blend_span_argb", bench_blend_span_argb, &ctx, screen);
+        run_case("blit_opaque", bench_blit_opaque, &ctx, screen);
+        run_case("blit_alpha_test", bench_blit_alpha_test, &ctx, screen);
+        run_case("blit_blend", bench_blit_blend, &ctx, screen);
+        run_case("draw_char", bench_draw_char, &ctx, (double)(sh / 16) * (sw / 8) * 8 * 16);
+        run_case("draw_text", bench_draw_text, &ctx, text_pixels(&ctx, text_line));
+        run_case("draw_text_utf8", bench_draw_text_utf8, &ctx, text_pixels(&ctx, text_line_utf8));
+
+        for (size_t k = 0; k < sizeof(window_counts) / sizeof(window_counts[0]); k++) {
+            ctx.windows = window_counts[k];
+            double area = setup_windows(ctx.windows, sw, sh);
+            run_case("draw_window", bench_draw_window, &ctx, area);
+            run_case("redraw_all", bench_redraw_all, &ctx, screen);
+
+            set_minimized(true);
+            // a title bar is 23 rows, the top border and the bar itself
+            run_case("draw_title_bars", bench_draw_title_bars, &ctx, (double)ctx.windows * (sw / 2 + 6) * 23);
+            set_minimized(false);
+        }
+
+        free_windows();
+        free(argb_src);
+        free(ctx.buf);
+    }
+
+    printf("\n  ]\n}\n");
+    return 0;
+}
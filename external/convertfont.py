@@ -1,5 +1,25 @@
+import struct
+import sys
+
+# converts a BDF font into the glyph blob the server loads (see include/fonts.h)
+#
+#   python3 convertfont.py [font.bdf] > ../include/ter-u16n.h   embeddable header
+#   python3 convertfont.py [font.bdf] -o font.bin               raw blob for SQWS_FONT
+#
+# blob layout, little endian:
+#   header    magic "SQFN", u16 version, u8 width, u8 height, u32 glyph count,
+#             u32 default glyph, u16 page count, u16 reserved
+#   page map  u16[256], codepoint >> 8 -> page or 0xFFFF
+#   pages     u16[page count][256], codepoint & 0xFF -> glyph or 0xFFFF
+#   glyphs    u8[glyph count][height], one byte per row, msb is the left pixel
+
+MAGIC = b"SQFN"
+VERSION = 1
+NONE = 0xFFFF
+
 def parse_bdf(bdf_path):
     font = {}
+    props = {"width": 8, "height": 16, "default": None}
     with open(bdf_path) as f:
         lines = f
         while True:
@@ -7,8 +27,13 @@ def parse_bdf(bdf_path):
                 line = next(lines)
             except StopIteration:
                 break
-            if line.startswith("STARTCHAR"):
-                encoding = 0; bitmap = []; bbx_w=bbx_h=0
+            if line.startswith("FONTBOUNDINGBOX"):
+                _, w, h, *_ = line.split()
+                props["width"], props["height"] = int(w), int(h)
+            elif line.startswith("DEFAULT_CHAR"):
+                props["default"] = int(line.split()[1])
+            elif line.startswith("STARTCHAR"):
+                encoding = -1; bitmap = []; bbx_w=bbx_h=0
                 for line in lines:
                     if line.startswith("ENCODING"):
                         encoding = int(line.split()[1])
@@ -20,24 +45,69 @@ def parse_bdf(bdf_path):
                             bitmap.append(int(next(lines).strip(),16))
                     elif line.startswith("ENDCHAR"):
                         break
-                if 0 <= encoding < 128:
-                    arr = [0]*16
-                    for i in range(min(16, len(bitmap))):
+                # the blob only indexes the basic multilingual plane
+                if 0 <= encoding < 0x10000:
+                    arr = [0]*props["height"]
+                    for i in range(min(props["height"], len(bitmap))):
                         b = bitmap[i]
-                        if bbx_w > 8:
-                            b >>= (bbx_w - 8)
+                        # rows are padded to whole bytes, keep the leftmost 8 pixels
+                        pad = (bbx_w + 7) // 8 * 8
+                        if pad > 8:
+                            b >>= (pad - 8)
                         arr[i] = b & 0xFF
                     font[encoding] = arr
-    return font
-
-def gen_c(font, name="font8x16_basic"):
-    print(f"const uint8_t {name}[128][16] = {{")
-    for code in range(128):
-        if code in font:
-            glyph = ','.join(f"0x{b:02X}" for b in font[code])
-            print(f"  [{code}] = {{ {glyph} }},")
+    return font, props
+
+def build_blob(font, props):
+    if props["width"] > 8:
+        sys.exit("only fonts up to 8 pixels wide are supported")
+    height = props["height"]
+    codes = sorted(font)
+    glyph_index = {code: i for i, code in enumerate(codes)}
+
+    default = props["default"]
+    if default not in glyph_index:
+        default = 0xFFFD if 0xFFFD in glyph_index else ord("?")
+    default_glyph = glyph_index.get(default, 0)
+
+    page_map = [NONE]*256
+    pages = []
+    for code in codes:
+        page = code >> 8
+        if page_map[page] == NONE:
+            page_map[page] = len(pages)
+            pages.append([NONE]*256)
+        pages[page_map[page]][code & 0xFF] = glyph_index[code]
+
+    blob = bytearray()
+    blob += struct.pack("<4sHBBIIHH", MAGIC, VERSION, props["width"], height,
+                        len(codes), default_glyph, len(pages), 0)
+    blob += struct.pack("<256H", *page_map)
+    for page in pages:
+        blob += struct.pack("<256H", *page)
+    for code in codes:
+        blob += bytes(font[code])
+    return bytes(blob)
+
+def gen_c(blob, name="ter_u16n_blob"):
+    print("// generated by external/convertfont.py, do not edit")
+    print("#include <stdint.h>")
+    print(f"static const uint8_t {name}[{len(blob)}] __attribute__((aligned(4))) = {{")
+    for i in range(0, len(blob), 16):
+        print("  " + ",".join(f"0x{b:02X}" for b in blob[i:i+16]) + ",")
     print("};")
 
 if __name__=="__main__":
-    f = parse_bdf("ter-u16n.bdf")
-    gen_c(f)
+    args = sys.argv[1:]
+    out = None
+    if "-o" in args:
+        i = args.index("-o")
+        out = args[i+1]
+        del args[i:i+2]
+    font, props = parse_bdf(args[0] if args else "ter-u16n.bdf")
+    blob = build_blob(font, props)
+    if out:
+        with open(out, "wb") as f:
+            f.write(blob)
+    else:
+        gen_c(blob)
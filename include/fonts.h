@@ -1 +1,66 @@
-#include "ter-u16n.h"
\ No newline at end of file
+#ifndef FONTS_H
+#define FONTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// glyph blob written by external/convertfont.py. ter-u16n.h embeds one, a
+// different one can be mmapped from the path in SQWS_FONT
+//
+// a codepoint is looked up in two steps: page_map[cp >> 8] gives the page and
+// the page gives the glyph for cp & 0xFF. FONT_NONE marks holes in both
+#define FONT_MAGIC "SQFN"
+#define FONT_VERSION 1
+#define FONT_NONE 0xFFFF
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint8_t width, height;
+    uint32_t glyph_count;
+    uint32_t default_glyph;
+    uint16_t page_count;
+    uint16_t reserved;
+    uint16_t page_map[256];
+    // uint16_t pages[page_count][256];
+    // uint8_t glyphs[glyph_count][height];
+} font_blob_t;
+
+_Static_assert(sizeof(font_blob_t) == 532, "font blob header must match convertfont.py");
+
+typedef struct {
+    int width, height;
+    const uint16_t *page_map;
+    const uint16_t *pages;
+    const uint8_t *glyphs;
+    uint32_t glyph_count;
+    uint32_t default_glyph;
+} font_t;
+
+extern font_t font;
+
+bool font_init(void);
+void font_cleanup(void);
+
+// rows of the glyph for cp, the default glyph if the font has none
+static inline const uint8_t *font_glyph(uint32_t cp) {
+    uint32_t g = font.default_glyph;
+    if (cp <= 0xFFFF) {
+        uint16_t page = font.page_map[cp >> 8];
+        if (page != FONT_NONE && font.pages[page * 256 + (cp & 0xFF)] != FONT_NONE)
+            g = font.pages[page * 256 + (cp & 0xFF)];
+    }
+    return font.glyphs + g * font.height;
+}
+
+// decodes one UTF-8 sequence and advances *s past it. malformed input
+// decodes to U+FFFD one byte at a time, the terminating nul is not consumed
+uint32_t utf8_next(const char **s);
+
+// number of codepoints in a nul terminated UTF-8 string
+int utf8_len(const char *s);
+
+// longest prefix of s, at most max bytes, that doesn't cut a sequence in half
+int utf8_trim(const char *s, int max);
+
+#endif // FONTS_H
@@ -8,44 +8,137 @@
 #include <stdbool.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/mman.h>
 #include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
 #include <sys/un.h>
+#include <linux/memfd.h>
 
-#define SOCKET_PATH "sqws/sock"
-
-typedef struct window window_t;
+#include "sqwsproto.h"
 
-struct window {
-    bool used;
-    int x, y, w, h, canvas_w, canvas_h;
-    unsigned char color[4];
-    char title[64];
-    bool focused;
+#define SOCKET_PATH "sqws/sock"
 
-    unsigned char *canvas;
+// iovecs per writev, the kernel's limit
+#define SQWS_IOV_MAX 1024
 
-    bool minimized;
-    bool maximized;
-    int prev_x, prev_y, prev_w, prev_h, prev_canvas_w, prev_canvas_h;
-};
+#ifndef F_ADD_SEALS
+#define F_ADD_SEALS 1033
+#define F_SEAL_SEAL 0x0001
+#define F_SEAL_SHRINK 0x0002
+#endif
 
 typedef struct SqwsClient SqwsClient;
 typedef struct SqwsWindow SqwsWindow;
 
+typedef struct {
+    int x, y, w, h;
+} SqwsRect;
+
+// event pushed by the server for one of the client's windows
+typedef struct {
+    int type; // SQWS_MSG_KEY, SQWS_MSG_BUTTON, SQWS_MSG_MOTION or SQWS_MSG_CONFIGURE
+    int window;
+    uint64_t time_ns;
+    int code, value;
+    int x, y;
+    unsigned buttons;
+
+    // SQWS_MSG_CONFIGURE: the canvas size asked for, pass the event to
+    // sqws_ack_configure before drawing at that size
+    int width, height;
+    uint32_t serial;
+    unsigned state; // SQWS_STATE_*
+} SqwsEvent;
+
 struct SqwsClient {
     int fd;
+
+    // commands not sent yet. they go out together, with the next pixel upload,
+    // the next command that waits for a reply, sqws_poll_event or sqws_flush
+    unsigned char tx[4096] __attribute__((aligned(8)));
+    size_t tx_len;
+
+    // messages from the server, read ahead of what has been asked for
+    unsigned char rx[4096];
+    size_t rx_len;
+
+    // events received and not yet taken, a ring that grows as needed
+    SqwsEvent *events;
+    size_t event_head, event_count, event_cap;
 };
 
 struct SqwsWindow {
     SqwsClient *client;
     int idx;
-    window_t info;
+    sqws_window_info_t info;
     unsigned char *canvas;
     size_t canvas_size;
+
+    // shared canvas, canvas points at the buffer the server isn't showing.
+    // shared is set once one was attached, it is shared again after resizes
+    unsigned char *shm_map;
+    int shm_back;
+    bool shared;
+
+    // acked a configure, the server waits for the whole canvas at that size
+    bool resized;
 };
 
+static inline int sqws_writev_all(int fd, struct iovec *iov, int count) {
+    while (count > 0) {
+        ssize_t w = writev(fd, iov, count);
+        if (w < 0) return -1;
+        while (count > 0 && (size_t)w >= iov->iov_len) {
+            w -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base = (char *)iov->iov_base + w;
+            iov->iov_len -= w;
+        }
+    }
+    return 0;
+}
+
+// sends the queued commands
+static inline int sqws_flush(SqwsClient *client) {
+    if (!client || !client->tx_len) return 0;
+    struct iovec iov = { client->tx, client->tx_len };
+    client->tx_len = 0;
+    return sqws_writev_all(client->fd, &iov, 1);
+}
+
+// queues a command and returns where its payload goes, size bytes rounded up
+// to a multiple of 4. NULL if it doesn't fit in the queue even when empty
+static inline void *sqws_queue_cmd(SqwsClient *client, int opcode, int idx, int arg, size_t size) {
+    size_t len = sizeof(sqws_cmd_header_t) + ((size + 3) & ~(size_t)3);
+    if (len > sizeof(client->tx)) return NULL;
+    if (client->tx_len + len > sizeof(client->tx) && sqws_flush(client) < 0) return NULL;
+    sqws_cmd_header_t hdr = { (uint8_t)opcode, (uint8_t)idx, (uint16_t)arg, (uint32_t)((size + 3) & ~(size_t)3) };
+    unsigned char *p = client->tx + client->tx_len;
+    memcpy(p, &hdr, sizeof(hdr));
+    memset(p + sizeof(hdr), 0, len - sizeof(hdr));
+    client->tx_len += len;
+    return p + sizeof(hdr);
+}
+
+// queues the header of a command whose payload follows from memory owned by
+// the caller, sent with the queue in one writev right away
+static inline int sqws_queue_header(SqwsClient *client, int opcode, int idx, int arg, size_t size) {
+    if (client->tx_len + sizeof(sqws_cmd_header_t) > sizeof(client->tx) && sqws_flush(client) < 0) return -1;
+    sqws_cmd_header_t hdr = { (uint8_t)opcode, (uint8_t)idx, (uint16_t)arg, (uint32_t)size };
+    memcpy(client->tx + client->tx_len, &hdr, sizeof(hdr));
+    client->tx_len += sizeof(hdr);
+    return 0;
+}
+
 static inline SqwsClient *sqws_connect(void) {
-    SqwsClient *client = malloc(sizeof(SqwsClient));
+    SqwsClient *client = calloc(1, sizeof(SqwsClient));
     if (!client) return NULL;
     int fd = socket(AF_UNIX, SOCK_STREAM, 0);
     if (fd < 0) { perror("socket"); free(client); return NULL; }
@@ -64,33 +157,156 @@ static inline SqwsClient *sqws_connect(void) {
 
 static inline void sqws_disconnect(SqwsClient *client) {
     if (client) {
+        sqws_flush(client);
         close(client->fd);
+        free(client->events);
         free(client);
     }
 }
 
-static inline SqwsWindow *sqws_create_window(SqwsClient *client, int idx, const char *title, int x, int y, int w, int h, const uint8_t *color) {
+// the socket, to wait on with poll() next to other fds. when it's readable
+// sqws_poll_event has something to read
+static inline int sqws_fd(SqwsClient *client) {
+    return client ? client->fd : -1;
+}
+
+static inline int sqws_queue_event(SqwsClient *client, const sqws_msg_header_t *hdr, const unsigned char *payload) {
+    SqwsEvent ev = { .type = hdr->type, .window = hdr->window };
+    if (hdr->type == SQWS_MSG_CONFIGURE) {
+        if (hdr->size < sizeof(sqws_configure_t)) return 0;
+        sqws_configure_t cfg;
+        memcpy(&cfg, payload, sizeof(cfg));
+        ev.width = cfg.w;
+        ev.height = cfg.h;
+        ev.serial = cfg.serial;
+        ev.state = cfg.state;
+    } else {
+        if (hdr->size < sizeof(sqws_input_t)) return 0;
+        sqws_input_t in;
+        memcpy(&in, payload, sizeof(in));
+        ev.time_ns = in.time_ns;
+        ev.code = in.code;
+        ev.value = in.value;
+        ev.x = in.x;
+        ev.y = in.y;
+        ev.buttons = in.buttons;
+    }
+    if (client->event_count == client->event_cap) {
+        size_t cap = client->event_cap ? client->event_cap * 2 : 64;
+        SqwsEvent *events = malloc(cap * sizeof(*events));
+        if (!events) return -1;
+        for (size_t i = 0; i < client->event_count; i++)
+            events[i] = client->events[(client->event_head + i) % client->event_cap];
+        free(client->events);
+        client->events = events;
+        client->event_head = 0;
+        client->event_cap = cap;
+    }
+    client->events[(client->event_head + client->event_count++) % client->event_cap] = ev;
+    return 0;
+}
+
+// takes the complete messages out of rx. events are queued, a reply is
+// copied to reply and ends the parsing: 1 when one was found, its header in
+// *reply_hdr
+static inline int sqws_parse(SqwsClient *client, void *reply, size_t reply_len, sqws_msg_header_t *reply_hdr) {
+    size_t pos = 0;
+    int found = 0;
+    while (!found && client->rx_len - pos >= sizeof(sqws_msg_header_t)) {
+        sqws_msg_header_t hdr;
+        memcpy(&hdr, client->rx + pos, sizeof(hdr));
+        if (client->rx_len - pos - sizeof(hdr) < hdr.size) break;
+        const unsigned char *payload = client->rx + pos + sizeof(hdr);
+        if (hdr.type == SQWS_MSG_REPLY) {
+            if (reply) {
+                memcpy(reply, payload, hdr.size < reply_len ? hdr.size : reply_len);
+                *reply_hdr = hdr;
+                found = 1;
+            }
+        } else if (sqws_queue_event(client, &hdr, payload) < 0) {
+            break;
+        }
+        pos += sizeof(hdr) + hdr.size;
+    }
+    memmove(client->rx, client->rx + pos, client->rx_len - pos);
+    client->rx_len -= pos;
+    return found;
+}
+
+// reads what the server sent. 1 when something came in, 0 when there was
+// nothing to read without blocking, -1 when the connection is gone
+static inline int sqws_fill(SqwsClient *client, bool block) {
+    for (;;) {
+        ssize_t r = recv(client->fd, client->rx + client->rx_len, sizeof(client->rx) - client->rx_len,
+                         block ? 0 : MSG_DONTWAIT);
+        if (r > 0) {
+            client->rx_len += r;
+            return 1;
+        }
+        if (r == 0) return -1;
+        if (errno == EINTR) continue;
+        return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+    }
+}
+
+// waits for the reply to the last command, queueing the events that come
+// before it. returns the window the reply is about, -1 unless the reply is
+// exactly len bytes
+static inline int sqws_read_reply(SqwsClient *client, void *reply, size_t len) {
+    sqws_msg_header_t hdr = {0};
+    if (sqws_flush(client) < 0) return -1;
+    while (!sqws_parse(client, reply, len, &hdr)) {
+        if (sqws_fill(client, true) < 0) return -1;
+    }
+    return hdr.size == len ? hdr.window : -1;
+}
+
+// takes the next input event without blocking. 1 when ev was filled in, 0
+// when there is none, -1 when the connection is gone
+static inline int sqws_poll_event(SqwsClient *client, SqwsEvent *ev) {
+    if (!client) return -1;
+    if (sqws_flush(client) < 0) return -1;
+    if (!client->event_count) {
+        int r;
+        while ((r = sqws_fill(client, false)) > 0) sqws_parse(client, NULL, 0, NULL);
+        if (r < 0 && !client->event_count) return -1;
+        if (!client->event_count) return 0;
+    }
+    *ev = client->events[client->event_head];
+    client->event_head = (client->event_head + 1) % client->event_cap;
+    client->event_count--;
+    return 1;
+}
+
+// like sqws_poll_event but waits up to timeout_ms for an event, -1 for ever
+static inline int sqws_wait_event(SqwsClient *client, SqwsEvent *ev, int timeout_ms) {
+    int r = sqws_poll_event(client, ev);
+    if (r) return r;
+    struct pollfd pfd = { .fd = client->fd, .events = POLLIN };
+    if (poll(&pfd, 1, timeout_ms) <= 0) return 0;
+    return sqws_poll_event(client, ev);
+}
+
+// the server picks the window's id, win->idx, and answers with its info
+static inline SqwsWindow *sqws_create_window(SqwsClient *client, const char *title, int x, int y, int w, int h, const uint8_t *color) {
     if (!client) return NULL;
 
     SqwsWindow *win = malloc(sizeof(SqwsWindow));
     if (!win) return NULL;
 
     win->client = client;
-    win->idx = idx;
-
-    uint8_t cmd = 0x01;
-    uint8_t buf[85] = {0};
-    buf[0] = idx;
-    strncpy((char*)(buf+1), title, 64);
-    int *p = (int*)(buf+65);
-    p[0] = x; p[1] = y; p[2] = w; p[3] = h;
-    memcpy(buf+81, color, 4);
-    write(client->fd, &cmd, 1);
-    write(client->fd, buf, sizeof(buf));
-
-    uint8_t cmd2[2] = {0x10, (uint8_t)idx};
-    if (write(client->fd, cmd2, 2) != 2 ||
-        read(client->fd, &win->info, sizeof(window_t)) != sizeof(window_t)) {
+
+    sqws_create_t *cr = sqws_queue_cmd(client, SQWS_CMD_CREATE_WINDOW, 0, 0, sizeof(sqws_create_t));
+    if (!cr) {
+        free(win);
+        return NULL;
+    }
+    cr->x = x; cr->y = y; cr->w = w; cr->h = h;
+    memcpy(cr->color, color, 4);
+    strncpy(cr->title, title, sizeof(cr->title));
+
+    win->idx = sqws_read_reply(client, &win->info, sizeof(win->info));
+    if (win->idx < 0) {
         free(win);
         return NULL;
     }
@@ -102,69 +318,236 @@ static inline SqwsWindow *sqws_create_window(SqwsClient *client, int idx, const
         return NULL;
     }
     memset(win->canvas, 0, win->canvas_size);
+    win->shm_map = NULL;
+    win->shm_back = 0;
+    win->shared = false;
+    win->resized = false;
 
     return win;
 }
 
+// switch an existing window to a canvas shared with the server. afterwards
+// sqws_draw_window only hands the drawn buffer over instead of copying it,
+// and win->canvas alternates between two buffers, so don't rely on it
+// keeping what was drawn into it the frame before
+static inline int sqws_attach_shm(SqwsWindow *win) {
+    if (!win || win->shm_map) return -1;
+
+    size_t size = win->canvas_size * SQWS_SHM_BUFFERS;
+    int fd = (int)syscall(SYS_memfd_create, "sqws-canvas", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) return -1;
+    if (ftruncate(fd, size) < 0 || fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_SEAL) < 0) {
+        close(fd);
+        return -1;
+    }
+    unsigned char *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+
+    // the fd rides along with the command, queued ones go first
+    struct {
+        sqws_cmd_header_t hdr;
+        int32_t size[2];
+    } cmd = { { SQWS_CMD_ATTACH_SHM, (uint8_t)win->idx, 0, 2 * sizeof(int32_t) },
+              { win->info.canvas_w, win->info.canvas_h } };
+    char ctrl[CMSG_SPACE(sizeof(int))];
+    memset(ctrl, 0, sizeof(ctrl));
+    struct iovec iov = { .iov_base = &cmd, .iov_len = sizeof(cmd) };
+    struct msghdr msg = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = ctrl,
+        .msg_controllen = sizeof(ctrl),
+    };
+    struct cmsghdr *c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_SOCKET;
+    c->cmsg_type = SCM_RIGHTS;
+    c->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(c), &fd, sizeof(int));
+
+    uint8_t status = 0;
+    ssize_t sent = sqws_flush(win->client) < 0 ? -1 : sendmsg(win->client->fd, &msg, 0);
+    close(fd);
+    if (sent != sizeof(cmd) || sqws_read_reply(win->client, &status, 1) < 0 || !status) {
+        munmap(map, size);
+        return -1;
+    }
+
+    // the server shows buffer 0 until the first commit
+    free(win->canvas);
+    win->shm_map = map;
+    win->shared = true;
+    win->shm_back = 1;
+    win->canvas = map + win->canvas_size;
+    return 0;
+}
+
+static inline SqwsWindow *sqws_create_window_shm(SqwsClient *client, const char *title, int x, int y, int w, int h, const uint8_t *color) {
+    SqwsWindow *win = sqws_create_window(client, title, x, y, w, h, color);
+    if (win && sqws_attach_shm(win) < 0)
+        fprintf(stderr, "sqws: shared canvas unavailable, falling back to copies\n");
+    return win;
+}
+
 static inline void sqws_destroy_window(SqwsWindow *win) {
     if (!win) return;
-    uint8_t buf[2] = {0x02, (uint8_t)win->idx};
-    write(win->client->fd, buf, 2);
-    free(win->canvas);
+    sqws_queue_cmd(win->client, SQWS_CMD_DESTROY_WINDOW, win->idx, 0, 0);
+    if (win->shm_map) munmap(win->shm_map, win->canvas_size * SQWS_SHM_BUFFERS);
+    else free(win->canvas);
     free(win);
 }
 
 static inline void sqws_move_window(SqwsWindow *win, int x, int y) {
     if (!win) return;
-    unsigned char buf[8];
-    buf[0] = 0x03;
-    buf[1] = win->idx;
-    *(int*)&buf[2] = x;
-    *(int*)&buf[6] = y;
-    write(win->client->fd, buf, sizeof(buf));
+    int32_t *pos = sqws_queue_cmd(win->client, SQWS_CMD_MOVE_WINDOW, win->idx, 0, 2 * sizeof(int32_t));
+    if (pos) {
+        pos[0] = x;
+        pos[1] = y;
+    }
 }
 
 static inline void sqws_draw_window(SqwsWindow *win) {
     if (!win) return;
-    uint8_t cmd = 0x04;
-    write(win->client->fd, &cmd, 1);
-    write(win->client->fd, &win->idx, 1);
-    write(win->client->fd, win->canvas, win->canvas_size);
+    win->resized = false;
+    if (win->shm_map) {
+        uint8_t released;
+        if (!sqws_queue_cmd(win->client, SQWS_CMD_COMMIT_SHM, win->idx, win->shm_back, 0) ||
+            sqws_read_reply(win->client, &released, 1) < 0 || released >= SQWS_SHM_BUFFERS) {
+            return;
+        }
+        win->shm_back = released;
+        win->canvas = win->shm_map + win->canvas_size * released;
+        return;
+    }
+    SqwsClient *client = win->client;
+    if (sqws_queue_header(client, SQWS_CMD_DRAW_WINDOW, win->idx, 0, win->canvas_size) < 0) return;
+    struct iovec iov[2] = { { client->tx, client->tx_len }, { win->canvas, win->canvas_size } };
+    client->tx_len = 0;
+    sqws_writev_all(client->fd, iov, 2);
 }
 
-static inline int sqws_request_window_info(SqwsWindow *win) {
-    if (!win) return -1;
-    uint8_t cmd[2] = {0x10, (uint8_t)win->idx};
-    if (write(win->client->fd, cmd, 2) != 2 ||
-        read(win->client->fd, &win->info, sizeof(window_t)) != sizeof(window_t)) {
+// upload only the given rects of the canvas. pixels holds the whole canvas
+// with stride bytes per row, rects are in canvas coordinates
+static inline int sqws_upload_rects(SqwsWindow *win, const unsigned char *pixels, size_t stride, const SqwsRect *rects, int count) {
+    if (!win || count <= 0) return -1;
+    if (count > SQWS_MAX_RECTS) count = SQWS_MAX_RECTS;
+
+    SqwsClient *client = win->client;
+    int32_t clipped[SQWS_MAX_RECTS][4];
+    int n = 0;
+    size_t size = 0;
+    for (int i = 0; i < count; i++) {
+        int x0 = rects[i].x < 0 ? 0 : rects[i].x;
+        int y0 = rects[i].y < 0 ? 0 : rects[i].y;
+        int x1 = rects[i].x + rects[i].w, y1 = rects[i].y + rects[i].h;
+        if (x1 > win->info.canvas_w) x1 = win->info.canvas_w;
+        if (y1 > win->info.canvas_h) y1 = win->info.canvas_h;
+        if (x1 <= x0 || y1 <= y0) continue;
+        clipped[n][0] = x0; clipped[n][1] = y0;
+        clipped[n][2] = x1 - x0; clipped[n][3] = y1 - y0;
+        size += sizeof(clipped[0]) + (size_t)clipped[n][2] * clipped[n][3] * 4;
+        n++;
+    }
+    if (!n) return 0;
+
+    // the queue, this command's header and rect list, then the rows straight
+    // from pixels. rows that follow each other in memory go out as one
+    if (client->tx_len + sizeof(sqws_cmd_header_t) + n * sizeof(clipped[0]) > sizeof(client->tx) &&
+        sqws_flush(client) < 0)
         return -1;
+    if (sqws_queue_header(client, SQWS_CMD_DRAW_RECTS, win->idx, n, size) < 0) return -1;
+    memcpy(client->tx + client->tx_len, clipped, n * sizeof(clipped[0]));
+    client->tx_len += n * sizeof(clipped[0]);
+
+    struct iovec iov[SQWS_IOV_MAX];
+    int k = 0;
+    iov[k++] = (struct iovec){ client->tx, client->tx_len };
+    client->tx_len = 0;
+    for (int i = 0; i < n; i++) {
+        size_t row = (size_t)clipped[i][2] * 4;
+        const unsigned char *src = pixels + (size_t)clipped[i][1] * stride + (size_t)clipped[i][0] * 4;
+        int rows = row == stride ? 1 : clipped[i][3];
+        if (row == stride) row *= clipped[i][3];
+        for (int r = 0; r < rows; r++) {
+            if (k == SQWS_IOV_MAX) {
+                if (sqws_writev_all(client->fd, iov, k) < 0) return -1;
+                k = 0;
+            }
+            iov[k++] = (struct iovec){ (void *)(src + r * stride), row };
+        }
     }
-    return 0;
+    return sqws_writev_all(client->fd, iov, k);
 }
 
-static inline unsigned char sqws_get_key(SqwsWindow *win) {
-    if (!win) return 0;
-    uint8_t cmd[2] = {0x11, (uint8_t)win->idx};
-    if (write(win->client->fd, cmd, 2) != 2) {
+// send only the changed parts of win->canvas. a shared canvas is handed
+// over whole, the server reads it in place anyway
+static inline int sqws_draw_window_rects(SqwsWindow *win, const SqwsRect *rects, int count) {
+    if (!win) return -1;
+    if (win->shm_map || win->resized) {
+        sqws_draw_window(win);
         return 0;
     }
-    unsigned char key = 0;
-    ssize_t r = read(win->client->fd, &key, sizeof(key));
-    if (r != sizeof(key)) return 0;
-    return key;
+    return sqws_upload_rects(win, win->canvas, (size_t)win->info.canvas_w * 4, rects, count);
 }
 
-static inline int sqws_get_mouse_pos(SqwsWindow *win, int *out_x, int *out_y) {
+// takes the size a SQWS_MSG_CONFIGURE event asks for: the canvas is replaced
+// by a blank one of that size and the server is told. draw it and send it
+// with sqws_draw_window, the server shows the old canvas until then
+static inline int sqws_ack_configure(SqwsWindow *win, const SqwsEvent *ev) {
+    if (!win || ev->type != SQWS_MSG_CONFIGURE || ev->width <= 0 || ev->height <= 0) return -1;
+    size_t size = (size_t)ev->width * ev->height * 4;
+    unsigned char *canvas = calloc(1, size);
+    if (!canvas) return -1;
+    uint32_t *serial = sqws_queue_cmd(win->client, SQWS_CMD_ACK_CONFIGURE, win->idx, 0, sizeof(uint32_t));
+    if (!serial) {
+        free(canvas);
+        return -1;
+    }
+    *serial = ev->serial;
+
+    if (win->shm_map) munmap(win->shm_map, win->canvas_size * SQWS_SHM_BUFFERS);
+    else free(win->canvas);
+    win->shm_map = NULL;
+    win->canvas = canvas;
+    win->canvas_size = size;
+    win->info.canvas_w = ev->width;
+    win->info.canvas_h = ev->height;
+    win->resized = true;
+    // a shared canvas is shared again at the new size. the server refuses it
+    // when it has asked for another size meanwhile, this one is then sent as
+    // a copy, which it drops, and the next configure tries again
+    if (win->shared) sqws_attach_shm(win);
+    return 0;
+}
+
+// SQWS_SURFACE_OPAQUE, SQWS_SURFACE_ALPHA_TEST or SQWS_SURFACE_BLEND
+static inline void sqws_set_surface_mode(SqwsWindow *win, int surface_mode) {
+    if (!win) return;
+    sqws_queue_cmd(win->client, SQWS_CMD_SET_SURFACE, win->idx, surface_mode, 0);
+}
+
+// covers the whole output without decorations, or goes back to the size and
+// spot from before. the size to draw at comes as a SQWS_MSG_CONFIGURE. an
+// opaque shared canvas then goes to the display without any copy when
+// nothing is drawn over it
+static inline void sqws_set_fullscreen(SqwsWindow *win, bool on) {
+    if (!win) return;
+    sqws_queue_cmd(win->client, SQWS_CMD_SET_FULLSCREEN, win->idx, on ? 1 : 0, 0);
+}
+
+// the canvas size stays what was last acked, the server only catches up
+// with it once the canvas of that size has been sent
+static inline int sqws_request_window_info(SqwsWindow *win) {
     if (!win) return -1;
-    uint8_t cmd[2] = {0x12, (uint8_t)win->idx};
-    if (write(win->client->fd, cmd, 2) != 2) {
+    int canvas_w = win->info.canvas_w, canvas_h = win->info.canvas_h;
+    if (!sqws_queue_cmd(win->client, SQWS_CMD_WINDOW_INFO, win->idx, 0, 0) ||
+        sqws_read_reply(win->client, &win->info, sizeof(win->info)) < 0) {
         return -1;
     }
-    int pos[2] = {0,0};
-    ssize_t r = read(win->client->fd, pos, sizeof(pos));
-    if (r != sizeof(pos)) return -1;
-    *out_x = pos[0];
-    *out_y = pos[1];
+    win->info.canvas_w = canvas_w;
+    win->info.canvas_h = canvas_h;
     return 0;
 }
 
@@ -0,0 +1,117 @@
+#ifndef SQWSPROTO_H
+#define SQWSPROTO_H
+
+#include <stdint.h>
+
+// client -> server commands. each one is a header and size bytes of payload,
+// size is a multiple of 4 so the fields of every command in a stream stay
+// naturally aligned. the server skips the payload of commands it doesn't know
+typedef struct {
+    uint8_t opcode; // SQWS_CMD_*
+    uint8_t window; // id the server handed out for it, see CREATE_WINDOW
+    uint16_t arg;
+    uint32_t size;
+} sqws_cmd_header_t;
+
+#define SQWS_CMD_CREATE_WINDOW   0x01 // sqws_create_t -> sqws_window_info_t, the reply's
+                                      // window is the id of the new window
+#define SQWS_CMD_DESTROY_WINDOW  0x02
+#define SQWS_CMD_MOVE_WINDOW     0x03 // i32 x, y
+#define SQWS_CMD_DRAW_WINDOW     0x04 // canvas_w * canvas_h * 4 bytes of pixels
+#define SQWS_CMD_ATTACH_SHM      0x05 // i32 w, h of the canvas the memfd passed
+                                      // with SCM_RIGHTS holds -> u8 status. 0
+                                      // unless that is the size last acked, or
+                                      // the canvas size when no ack is pending
+#define SQWS_CMD_COMMIT_SHM      0x06 // arg buffer -> u8 released buffer
+#define SQWS_CMD_DRAW_RECTS      0x07 // arg count, count * i32 {x, y, w, h}, then
+                                      // w * h * 4 bytes of pixels per rect, row by row
+#define SQWS_CMD_SET_SURFACE     0x08 // arg SQWS_SURFACE_*
+#define SQWS_CMD_ACK_CONFIGURE   0x09 // u32 serial of the SQWS_MSG_CONFIGURE the
+                                      // canvas is redrawn for, see there
+#define SQWS_CMD_SET_FULLSCREEN  0x0A // arg 1 to cover the whole output without
+                                      // decorations, 0 to go back. the new size
+                                      // comes with a SQWS_MSG_CONFIGURE
+
+#define SQWS_CMD_WINDOW_INFO     0x10 // -> sqws_window_info_t
+
+typedef struct {
+    int32_t x, y, w, h;
+    uint8_t color[4];
+    char title[64]; // UTF-8, nul terminated unless all 64 bytes are used
+} sqws_create_t;
+
+// largest canvas width or height, bigger windows aren't created
+#define SQWS_MAX_CANVAS 16384
+
+typedef struct {
+    int32_t x, y, w, h; // the frame, decorations included, on the output
+    int32_t canvas_w, canvas_h;
+    uint8_t color[4];
+    char title[64]; // nul terminated
+    uint32_t flags; // SQWS_WINDOW_*
+    uint32_t surface_mode; // SQWS_SURFACE_*
+} sqws_window_info_t;
+
+#define SQWS_WINDOW_FOCUSED      0x01
+#define SQWS_WINDOW_MINIMIZED    0x02
+#define SQWS_WINDOW_MAXIMIZED    0x04
+#define SQWS_WINDOW_FULLSCREEN   0x08
+
+#define SQWS_MAX_RECTS 255
+
+// server -> client messages. each one is a header and size bytes of payload.
+// replies come in the order the commands were sent, input events for the
+// focused window are pushed in between whenever they happen
+typedef struct {
+    uint8_t type; // SQWS_MSG_*
+    uint8_t window; // id of the client's window it is about
+    uint16_t size;
+} sqws_msg_header_t;
+
+#define SQWS_MSG_REPLY           0x01 // the reply to a command, empty if it failed
+#define SQWS_MSG_KEY             0x02 // sqws_input_t, code is a VK code
+#define SQWS_MSG_BUTTON          0x03 // sqws_input_t, code is one SQWS_BUTTON_*
+#define SQWS_MSG_MOTION          0x04 // sqws_input_t, at most one per frame
+#define SQWS_MSG_CONFIGURE       0x05 // sqws_configure_t
+
+#define SQWS_BUTTON_LEFT         0x01
+#define SQWS_BUTTON_RIGHT        0x02
+#define SQWS_BUTTON_MIDDLE       0x04
+
+typedef struct {
+    uint64_t time_ns; // CLOCK_MONOTONIC when it happened, as far as the
+                      // device tells
+    uint16_t code;
+    int16_t value;    // keys: 1 down, 0 up, 2 repeat. buttons: 1 down, 0 up
+    int32_t x, y;     // pointer position relative to the window's canvas
+    uint32_t buttons; // SQWS_BUTTON_* held down
+} sqws_input_t;
+
+// the window was resized, by the user or by maximizing it. the frame takes
+// the new size right away and the old canvas is shown clipped or padded in it
+// until the client acks the serial with SQWS_CMD_ACK_CONFIGURE and then sends
+// a whole canvas of w x h, with SQWS_CMD_DRAW_WINDOW or, for a shared canvas,
+// SQWS_CMD_ATTACH_SHM of the new size and a commit. only the last configure
+// counts, acks of older ones are ignored
+typedef struct {
+    uint32_t serial;
+    int32_t w, h;    // canvas size
+    uint32_t state;  // SQWS_STATE_*
+} sqws_configure_t;
+
+#define SQWS_STATE_MAXIMIZED     0x01
+#define SQWS_STATE_FULLSCREEN    0x02 // w x h is the output, opaque canvases of
+                                      // that size are shown without composing
+
+// how a canvas is combined with what is behind it
+#define SQWS_SURFACE_OPAQUE      0 // alpha is ignored, the default
+#define SQWS_SURFACE_ALPHA_TEST  1 // pixels with alpha < 128 are not drawn
+#define SQWS_SURFACE_BLEND       2 // blended with the per-pixel alpha
+
+// a shared canvas holds this many canvas_w * canvas_h * 4 buffers back to back.
+// the released buffer a commit replies with is free to draw into. while the
+// canvas is scanned out as it is that reply only comes once the display has
+// stopped showing the buffer, about a frame later
+#define SQWS_SHM_BUFFERS 2
+
+#endif // SQWSPROTO_H
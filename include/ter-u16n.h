@@ -1,99 +1,2034 @@
+// generated by external/convertfont.py, do not edit
 #include <stdint.h>
-const uint8_t font8x16_basic[128][16] = {
-  [0] = { 0x00,0x00,0x66,0x42,0x00,0x42,0x42,0x42,0x00,0x42,0x42,0x66,0x00,0x00,0x00,0x00 },
-  [32] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [33] = { 0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [34] = { 0x00,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [35] = { 0x00,0x00,0x24,0x24,0x24,0x7E,0x24,0x24,0x7E,0x24,0x24,0x24,0x00,0x00,0x00,0x00 },
-  [36] = { 0x00,0x10,0x10,0x7C,0x92,0x90,0x90,0x7C,0x12,0x12,0x92,0x7C,0x10,0x10,0x00,0x00 },
-  [37] = { 0x00,0x00,0x64,0x94,0x68,0x08,0x10,0x10,0x20,0x2C,0x52,0x4C,0x00,0x00,0x00,0x00 },
-  [38] = { 0x00,0x00,0x18,0x24,0x24,0x18,0x30,0x4A,0x44,0x44,0x44,0x3A,0x00,0x00,0x00,0x00 },
-  [39] = { 0x00,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [40] = { 0x00,0x00,0x08,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x08,0x00,0x00,0x00,0x00 },
-  [41] = { 0x00,0x00,0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x20,0x00,0x00,0x00,0x00 },
-  [42] = { 0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x7E,0x18,0x24,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [43] = { 0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [44] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x20,0x00,0x00,0x00 },
-  [45] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [46] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [47] = { 0x00,0x00,0x04,0x04,0x08,0x08,0x10,0x10,0x20,0x20,0x40,0x40,0x00,0x00,0x00,0x00 },
-  [48] = { 0x00,0x00,0x3C,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [49] = { 0x00,0x00,0x08,0x18,0x28,0x08,0x08,0x08,0x08,0x08,0x08,0x3E,0x00,0x00,0x00,0x00 },
-  [50] = { 0x00,0x00,0x3C,0x42,0x42,0x02,0x04,0x08,0x10,0x20,0x40,0x7E,0x00,0x00,0x00,0x00 },
-  [51] = { 0x00,0x00,0x3C,0x42,0x42,0x02,0x1C,0x02,0x02,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [52] = { 0x00,0x00,0x02,0x06,0x0A,0x12,0x22,0x42,0x7E,0x02,0x02,0x02,0x00,0x00,0x00,0x00 },
-  [53] = { 0x00,0x00,0x7E,0x40,0x40,0x40,0x7C,0x02,0x02,0x02,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [54] = { 0x00,0x00,0x1C,0x20,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [55] = { 0x00,0x00,0x7E,0x02,0x02,0x04,0x04,0x08,0x08,0x10,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [56] = { 0x00,0x00,0x3C,0x42,0x42,0x42,0x3C,0x42,0x42,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [57] = { 0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x04,0x38,0x00,0x00,0x00,0x00 },
-  [58] = { 0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [59] = { 0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x10,0x10,0x20,0x00,0x00,0x00 },
-  [60] = { 0x00,0x00,0x00,0x04,0x08,0x10,0x20,0x40,0x20,0x10,0x08,0x04,0x00,0x00,0x00,0x00 },
-  [61] = { 0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [62] = { 0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x08,0x10,0x20,0x40,0x00,0x00,0x00,0x00 },
-  [63] = { 0x00,0x00,0x3C,0x42,0x42,0x42,0x04,0x08,0x08,0x00,0x08,0x08,0x00,0x00,0x00,0x00 },
-  [64] = { 0x00,0x00,0x7C,0x82,0x9E,0xA2,0xA2,0xA2,0xA6,0x9A,0x80,0x7E,0x00,0x00,0x00,0x00 },
-  [65] = { 0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [66] = { 0x00,0x00,0x7C,0x42,0x42,0x42,0x7C,0x42,0x42,0x42,0x42,0x7C,0x00,0x00,0x00,0x00 },
-  [67] = { 0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x40,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [68] = { 0x00,0x00,0x78,0x44,0x42,0x42,0x42,0x42,0x42,0x42,0x44,0x78,0x00,0x00,0x00,0x00 },
-  [69] = { 0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,0x00,0x00,0x00,0x00 },
-  [70] = { 0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x00,0x00 },
-  [71] = { 0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [72] = { 0x00,0x00,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [73] = { 0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,0x00,0x00,0x00,0x00 },
-  [74] = { 0x00,0x00,0x0E,0x04,0x04,0x04,0x04,0x04,0x04,0x44,0x44,0x38,0x00,0x00,0x00,0x00 },
-  [75] = { 0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,0x00,0x00,0x00,0x00 },
-  [76] = { 0x00,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,0x00,0x00,0x00,0x00 },
-  [77] = { 0x00,0x00,0x82,0xC6,0xAA,0x92,0x92,0x82,0x82,0x82,0x82,0x82,0x00,0x00,0x00,0x00 },
-  [78] = { 0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [79] = { 0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [80] = { 0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,0x40,0x40,0x00,0x00,0x00,0x00 },
-  [81] = { 0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x4A,0x3C,0x02,0x00,0x00,0x00 },
-  [82] = { 0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x50,0x48,0x44,0x42,0x00,0x00,0x00,0x00 },
-  [83] = { 0x00,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [84] = { 0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [85] = { 0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [86] = { 0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x24,0x24,0x24,0x18,0x18,0x00,0x00,0x00,0x00 },
-  [87] = { 0x00,0x00,0x82,0x82,0x82,0x82,0x82,0x92,0x92,0xAA,0xC6,0x82,0x00,0x00,0x00,0x00 },
-  [88] = { 0x00,0x00,0x42,0x42,0x24,0x24,0x18,0x18,0x24,0x24,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [89] = { 0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [90] = { 0x00,0x00,0x7E,0x02,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x7E,0x00,0x00,0x00,0x00 },
-  [91] = { 0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x38,0x00,0x00,0x00,0x00 },
-  [92] = { 0x00,0x00,0x40,0x40,0x20,0x20,0x10,0x10,0x08,0x08,0x04,0x04,0x00,0x00,0x00,0x00 },
-  [93] = { 0x00,0x00,0x38,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x38,0x00,0x00,0x00,0x00 },
-  [94] = { 0x00,0x10,0x28,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [95] = { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00 },
-  [96] = { 0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-  [97] = { 0x00,0x00,0x00,0x00,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,0x00,0x00,0x00,0x00 },
-  [98] = { 0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,0x00,0x00,0x00,0x00 },
-  [99] = { 0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [100] = { 0x00,0x00,0x02,0x02,0x02,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,0x00,0x00,0x00,0x00 },
-  [101] = { 0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,0x00,0x00,0x00,0x00 },
-  [102] = { 0x00,0x00,0x0E,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [103] = { 0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x3C,0x00 },
-  [104] = { 0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [105] = { 0x00,0x00,0x10,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,0x00,0x00,0x00,0x00 },
-  [106] = { 0x00,0x00,0x04,0x04,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,0x44,0x44,0x38,0x00 },
-  [107] = { 0x00,0x00,0x40,0x40,0x40,0x42,0x44,0x48,0x70,0x48,0x44,0x42,0x00,0x00,0x00,0x00 },
-  [108] = { 0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,0x00,0x00,0x00,0x00 },
-  [109] = { 0x00,0x00,0x00,0x00,0x00,0xFC,0x92,0x92,0x92,0x92,0x92,0x92,0x00,0x00,0x00,0x00 },
-  [110] = { 0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [111] = { 0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,0x00,0x00,0x00,0x00 },
-  [112] = { 0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,0x40,0x00 },
-  [113] = { 0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x00 },
-  [114] = { 0x00,0x00,0x00,0x00,0x00,0x5E,0x60,0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x00,0x00 },
-  [115] = { 0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,0x00,0x00,0x00,0x00 },
-  [116] = { 0x00,0x00,0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x0E,0x00,0x00,0x00,0x00 },
-  [117] = { 0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,0x00,0x00,0x00,0x00 },
-  [118] = { 0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x24,0x24,0x18,0x18,0x00,0x00,0x00,0x00 },
-  [119] = { 0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x92,0x92,0x92,0x92,0x7C,0x00,0x00,0x00,0x00 },
-  [120] = { 0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x18,0x24,0x42,0x42,0x00,0x00,0x00,0x00 },
-  [121] = { 0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x3C,0x00 },
-  [122] = { 0x00,0x00,0x00,0x00,0x00,0x7E,0x04,0x08,0x10,0x20,0x40,0x7E,0x00,0x00,0x00,0x00 },
-  [123] = { 0x00,0x00,0x0C,0x10,0x10,0x10,0x20,0x10,0x10,0x10,0x10,0x0C,0x00,0x00,0x00,0x00 },
-  [124] = { 0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00 },
-  [125] = { 0x00,0x00,0x30,0x08,0x08,0x08,0x04,0x08,0x08,0x08,0x08,0x30,0x00,0x00,0x00,0x00 },
-  [126] = { 0x00,0x62,0x92,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
-};
\ No newline at end of file
+static const uint8_t ter_u16n_blob[32468] __attribute__((aligned(4))) = {
+  0x53,0x51,0x46,0x4E,0x01,0x00,0x08,0x10,0x4C,0x05,0x00,0x00,0x4B,0x05,0x00,0x00,
+  0x14,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x06,0x00,0xFF,0xFF,0x07,0x00,0x08,0x00,0x09,0x00,0x0A,0x00,0x0B,0x00,0x0C,0x00,
+  0x0D,0x00,0x0E,0x00,0x0F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x10,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x11,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x12,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0x13,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x01,0x00,0x02,0x00,0x03,0x00,0x04,0x00,0x05,0x00,0x06,0x00,
+  0x07,0x00,0x08,0x00,0x09,0x00,0x0A,0x00,0x0B,0x00,0x0C,0x00,0x0D,0x00,0x0E,0x00,
+  0x0F,0x00,0x10,0x00,0x11,0x00,0x12,0x00,0x13,0x00,0x14,0x00,0x15,0x00,0x16,0x00,
+  0x17,0x00,0x18,0x00,0x19,0x00,0x1A,0x00,0x1B,0x00,0x1C,0x00,0x1D,0x00,0x1E,0x00,
+  0x1F,0x00,0x20,0x00,0x21,0x00,0x22,0x00,0x23,0x00,0x24,0x00,0x25,0x00,0x26,0x00,
+  0x27,0x00,0x28,0x00,0x29,0x00,0x2A,0x00,0x2B,0x00,0x2C,0x00,0x2D,0x00,0x2E,0x00,
+  0x2F,0x00,0x30,0x00,0x31,0x00,0x32,0x00,0x33,0x00,0x34,0x00,0x35,0x00,0x36,0x00,
+  0x37,0x00,0x38,0x00,0x39,0x00,0x3A,0x00,0x3B,0x00,0x3C,0x00,0x3D,0x00,0x3E,0x00,
+  0x3F,0x00,0x40,0x00,0x41,0x00,0x42,0x00,0x43,0x00,0x44,0x00,0x45,0x00,0x46,0x00,
+  0x47,0x00,0x48,0x00,0x49,0x00,0x4A,0x00,0x4B,0x00,0x4C,0x00,0x4D,0x00,0x4E,0x00,
+  0x4F,0x00,0x50,0x00,0x51,0x00,0x52,0x00,0x53,0x00,0x54,0x00,0x55,0x00,0x56,0x00,
+  0x57,0x00,0x58,0x00,0x59,0x00,0x5A,0x00,0x5B,0x00,0x5C,0x00,0x5D,0x00,0x5E,0x00,
+  0x5F,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x61,0x00,0x62,0x00,0x63,0x00,0x64,0x00,0x65,0x00,
+  0x66,0x00,0x67,0x00,0x68,0x00,0x69,0x00,0x6A,0x00,0x6B,0x00,0x6C,0x00,0x6D,0x00,
+  0x6E,0x00,0x6F,0x00,0x70,0x00,0x71,0x00,0x72,0x00,0x73,0x00,0x74,0x00,0x75,0x00,
+  0x76,0x00,0x77,0x00,0x78,0x00,0x79,0x00,0x7A,0x00,0x7B,0x00,0x7C,0x00,0x7D,0x00,
+  0x7E,0x00,0x7F,0x00,0x80,0x00,0x81,0x00,0x82,0x00,0x83,0x00,0x84,0x00,0x85,0x00,
+  0x86,0x00,0x87,0x00,0x88,0x00,0x89,0x00,0x8A,0x00,0x8B,0x00,0x8C,0x00,0x8D,0x00,
+  0x8E,0x00,0x8F,0x00,0x90,0x00,0x91,0x00,0x92,0x00,0x93,0x00,0x94,0x00,0x95,0x00,
+  0x96,0x00,0x97,0x00,0x98,0x00,0x99,0x00,0x9A,0x00,0x9B,0x00,0x9C,0x00,0x9D,0x00,
+  0x9E,0x00,0x9F,0x00,0xA0,0x00,0xA1,0x00,0xA2,0x00,0xA3,0x00,0xA4,0x00,0xA5,0x00,
+  0xA6,0x00,0xA7,0x00,0xA8,0x00,0xA9,0x00,0xAA,0x00,0xAB,0x00,0xAC,0x00,0xAD,0x00,
+  0xAE,0x00,0xAF,0x00,0xB0,0x00,0xB1,0x00,0xB2,0x00,0xB3,0x00,0xB4,0x00,0xB5,0x00,
+  0xB6,0x00,0xB7,0x00,0xB8,0x00,0xB9,0x00,0xBA,0x00,0xBB,0x00,0xBC,0x00,0xBD,0x00,
+  0xBE,0x00,0xBF,0x00,0xC0,0x00,0xC1,0x00,0xC2,0x00,0xC3,0x00,0xC4,0x00,0xC5,0x00,
+  0xC6,0x00,0xC7,0x00,0xC8,0x00,0xC9,0x00,0xCA,0x00,0xCB,0x00,0xCC,0x00,0xCD,0x00,
+  0xCE,0x00,0xCF,0x00,0xD0,0x00,0xD1,0x00,0xD2,0x00,0xD3,0x00,0xD4,0x00,0xD5,0x00,
+  0xD6,0x00,0xD7,0x00,0xD8,0x00,0xD9,0x00,0xDA,0x00,0xDB,0x00,0xDC,0x00,0xDD,0x00,
+  0xDE,0x00,0xDF,0x00,0xE0,0x00,0xE1,0x00,0xE2,0x00,0xE3,0x00,0xE4,0x00,0xE5,0x00,
+  0xE6,0x00,0xE7,0x00,0xE8,0x00,0xE9,0x00,0xEA,0x00,0xEB,0x00,0xEC,0x00,0xED,0x00,
+  0xEE,0x00,0xEF,0x00,0xF0,0x00,0xF1,0x00,0xF2,0x00,0xF3,0x00,0xF4,0x00,0xF5,0x00,
+  0xF6,0x00,0xF7,0x00,0xF8,0x00,0xF9,0x00,0xFA,0x00,0xFB,0x00,0xFC,0x00,0xFD,0x00,
+  0xFE,0x00,0xFF,0x00,0x00,0x01,0x01,0x01,0x02,0x01,0x03,0x01,0x04,0x01,0x05,0x01,
+  0x06,0x01,0x07,0x01,0x08,0x01,0x09,0x01,0x0A,0x01,0x0B,0x01,0x0C,0x01,0x0D,0x01,
+  0x0E,0x01,0x0F,0x01,0x10,0x01,0x11,0x01,0x12,0x01,0x13,0x01,0x14,0x01,0x15,0x01,
+  0x16,0x01,0x17,0x01,0x18,0x01,0x19,0x01,0x1A,0x01,0x1B,0x01,0x1C,0x01,0x1D,0x01,
+  0x1E,0x01,0x1F,0x01,0x20,0x01,0x21,0x01,0x22,0x01,0x23,0x01,0x24,0x01,0x25,0x01,
+  0x26,0x01,0x27,0x01,0x28,0x01,0x29,0x01,0x2A,0x01,0x2B,0x01,0x2C,0x01,0x2D,0x01,
+  0x2E,0x01,0x2F,0x01,0x30,0x01,0x31,0x01,0x32,0x01,0x33,0x01,0x34,0x01,0x35,0x01,
+  0x36,0x01,0x37,0x01,0x38,0x01,0x39,0x01,0x3A,0x01,0x3B,0x01,0x3C,0x01,0x3D,0x01,
+  0x3E,0x01,0x3F,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x40,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x41,0x01,0x42,0x01,0x43,0x01,0xFF,0xFF,0x44,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x01,
+  0x46,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x47,0x01,
+  0x48,0x01,0x49,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4A,0x01,
+  0x4B,0x01,0x4C,0x01,0x4D,0x01,0x4E,0x01,0x4F,0x01,0x50,0x01,0x51,0x01,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x52,0x01,0x53,0x01,0x54,0x01,0x55,0x01,
+  0x56,0x01,0x57,0x01,0x58,0x01,0x59,0x01,0x5A,0x01,0x5B,0x01,0x5C,0x01,0x5D,0x01,
+  0x5E,0x01,0x5F,0x01,0x60,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x61,0x01,0x62,0x01,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x63,0x01,0x64,0x01,
+  0x65,0x01,0x66,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x67,0x01,0x68,0x01,0x69,0x01,0x6A,0x01,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x01,0x6C,0x01,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0x6D,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6E,0x01,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x6F,0x01,0x70,0x01,0xFF,0xFF,0x71,0x01,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x72,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x74,0x01,0x75,0x01,0x76,0x01,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x77,0x01,0x78,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x79,0x01,0x7A,0x01,0xFF,0xFF,0x7B,0x01,0x7C,0x01,0x7D,0x01,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x7E,0x01,0x7F,0x01,0x80,0x01,0x81,0x01,0x82,0x01,0x83,0x01,
+  0x84,0x01,0x85,0x01,0x86,0x01,0xFF,0xFF,0x87,0x01,0x88,0x01,0x89,0x01,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8A,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8B,0x01,0x8C,0x01,
+  0x8D,0x01,0x8E,0x01,0x8F,0x01,0x90,0x01,0x91,0x01,0xFF,0xFF,0x92,0x01,0xFF,0xFF,
+  0x93,0x01,0x94,0x01,0x95,0x01,0x96,0x01,0x97,0x01,0x98,0x01,0x99,0x01,0x9A,0x01,
+  0x9B,0x01,0x9C,0x01,0x9D,0x01,0x9E,0x01,0x9F,0x01,0xA0,0x01,0xA1,0x01,0xA2,0x01,
+  0xA3,0x01,0xA4,0x01,0xA5,0x01,0xA6,0x01,0xFF,0xFF,0xA7,0x01,0xA8,0x01,0xA9,0x01,
+  0xAA,0x01,0xAB,0x01,0xAC,0x01,0xAD,0x01,0xAE,0x01,0xAF,0x01,0xB0,0x01,0xB1,0x01,
+  0xB2,0x01,0xB3,0x01,0xB4,0x01,0xB5,0x01,0xB6,0x01,0xB7,0x01,0xB8,0x01,0xB9,0x01,
+  0xBA,0x01,0xBB,0x01,0xBC,0x01,0xBD,0x01,0xBE,0x01,0xBF,0x01,0xC0,0x01,0xC1,0x01,
+  0xC2,0x01,0xC3,0x01,0xC4,0x01,0xC5,0x01,0xC6,0x01,0xC7,0x01,0xC8,0x01,0xC9,0x01,
+  0xCA,0x01,0xCB,0x01,0xCC,0x01,0xCD,0x01,0xCE,0x01,0xCF,0x01,0xD0,0x01,0xD1,0x01,
+  0xD2,0x01,0xFF,0xFF,0xFF,0xFF,0xD3,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD4,0x01,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xD5,0x01,0xD6,0x01,0xD7,0x01,0xD8,0x01,0xD9,0x01,0xDA,0x01,
+  0xDB,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xDC,0x01,0xDD,0x01,0xDE,0x01,0xDF,0x01,0xE0,0x01,0xE1,0x01,
+  0xE2,0x01,0xE3,0x01,0xE4,0x01,0xE5,0x01,0xE6,0x01,0xE7,0x01,0xE8,0x01,0xE9,0x01,
+  0xEA,0x01,0xEB,0x01,0xEC,0x01,0xED,0x01,0xEE,0x01,0xEF,0x01,0xF0,0x01,0xF1,0x01,
+  0xF2,0x01,0xF3,0x01,0xF4,0x01,0xF5,0x01,0xF6,0x01,0xF7,0x01,0xF8,0x01,0xF9,0x01,
+  0xFA,0x01,0xFB,0x01,0xFC,0x01,0xFD,0x01,0xFE,0x01,0xFF,0x01,0x00,0x02,0x01,0x02,
+  0x02,0x02,0x03,0x02,0x04,0x02,0x05,0x02,0x06,0x02,0x07,0x02,0x08,0x02,0x09,0x02,
+  0x0A,0x02,0x0B,0x02,0x0C,0x02,0x0D,0x02,0x0E,0x02,0x0F,0x02,0x10,0x02,0x11,0x02,
+  0x12,0x02,0x13,0x02,0x14,0x02,0x15,0x02,0x16,0x02,0x17,0x02,0x18,0x02,0x19,0x02,
+  0x1A,0x02,0x1B,0x02,0x1C,0x02,0x1D,0x02,0x1E,0x02,0x1F,0x02,0x20,0x02,0x21,0x02,
+  0x22,0x02,0x23,0x02,0x24,0x02,0x25,0x02,0x26,0x02,0x27,0x02,0x28,0x02,0x29,0x02,
+  0x2A,0x02,0x2B,0x02,0x2C,0x02,0x2D,0x02,0x2E,0x02,0x2F,0x02,0x30,0x02,0x31,0x02,
+  0x32,0x02,0x33,0x02,0x34,0x02,0x35,0x02,0x36,0x02,0x37,0x02,0x38,0x02,0x39,0x02,
+  0x3A,0x02,0x3B,0x02,0xFF,0xFF,0xFF,0xFF,0x3C,0x02,0x3D,0x02,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3E,0x02,0x3F,0x02,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x40,0x02,0x41,0x02,0x42,0x02,0x43,0x02,0x44,0x02,0x45,0x02,
+  0x46,0x02,0x47,0x02,0x48,0x02,0x49,0x02,0x4A,0x02,0x4B,0x02,0x4C,0x02,0x4D,0x02,
+  0xFF,0xFF,0xFF,0xFF,0x4E,0x02,0x4F,0x02,0x50,0x02,0x51,0x02,0x52,0x02,0x53,0x02,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x54,0x02,0x55,0x02,0xFF,0xFF,0xFF,0xFF,
+  0x56,0x02,0x57,0x02,0x58,0x02,0x59,0x02,0x5A,0x02,0x5B,0x02,0xFF,0xFF,0xFF,0xFF,
+  0x5C,0x02,0x5D,0x02,0x5E,0x02,0x5F,0x02,0x60,0x02,0x61,0x02,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x62,0x02,0x63,0x02,0x64,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0x65,0x02,0x66,0x02,0x67,0x02,0x68,0x02,0x69,0x02,0x6A,0x02,0x6B,0x02,
+  0x6C,0x02,0x6D,0x02,0x6E,0x02,0x6F,0x02,0x70,0x02,0x71,0x02,0x72,0x02,0x73,0x02,
+  0x74,0x02,0x75,0x02,0xFF,0xFF,0xFF,0xFF,0x76,0x02,0x77,0x02,0x78,0x02,0x79,0x02,
+  0x7A,0x02,0x7B,0x02,0x7C,0x02,0x7D,0x02,0x7E,0x02,0x7F,0x02,0x80,0x02,0x81,0x02,
+  0x82,0x02,0x83,0x02,0x84,0x02,0x85,0x02,0x86,0x02,0x87,0x02,0x88,0x02,0x89,0x02,
+  0xFF,0xFF,0xFF,0xFF,0x8A,0x02,0x8B,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x8C,0x02,0x8D,0x02,0x8E,0x02,0x8F,0x02,0x90,0x02,0x91,0x02,
+  0x92,0x02,0x93,0x02,0x94,0x02,0x95,0x02,0x96,0x02,0x97,0x02,0x98,0x02,0x99,0x02,
+  0x9A,0x02,0x9B,0x02,0x9C,0x02,0x9D,0x02,0x9E,0x02,0x9F,0x02,0xA0,0x02,0xA1,0x02,
+  0xA2,0x02,0xA3,0x02,0xA4,0x02,0xA5,0x02,0xA6,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA7,0x02,0xA8,0x02,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA9,0x02,0xAA,0x02,
+  0xAB,0x02,0xAC,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xAD,0x02,0xAE,0x02,0xAF,0x02,0xB0,0x02,0xB1,0x02,0xB2,0x02,
+  0xB3,0x02,0xB4,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0x02,0xB6,0x02,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xB7,0x02,0xB8,0x02,0xFF,0xFF,0xFF,0xFF,0xB9,0x02,0xBA,0x02,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,0x02,0xBC,0x02,0xBD,0x02,0xBE,0x02,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0x02,0xC0,0x02,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xC1,0x02,0xC2,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xC3,0x02,0xC4,0x02,0xC5,0x02,0xC6,0x02,0xC7,0x02,0xC8,0x02,
+  0xC9,0x02,0xCA,0x02,0xCB,0x02,0xCC,0x02,0xCD,0x02,0xCE,0x02,0xCF,0x02,0xD0,0x02,
+  0xD1,0x02,0xD2,0x02,0xD3,0x02,0xD4,0x02,0xD5,0x02,0xD6,0x02,0xD7,0x02,0xD8,0x02,
+  0xD9,0x02,0xDA,0x02,0xDB,0x02,0xDC,0x02,0xDD,0x02,0xDE,0x02,0xDF,0x02,0xE0,0x02,
+  0xE1,0x02,0xE2,0x02,0xE3,0x02,0xE4,0x02,0xE5,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xE6,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xE7,0x02,0xFF,0xFF,0xE8,0x02,0xE9,0x02,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEA,0x02,0xEB,0x02,0xFF,0xFF,0xEC,0x02,0xFF,0xFF,
+  0xED,0x02,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xEE,0x02,0xEF,0x02,0xFF,0xFF,0xFF,0xFF,0xF0,0x02,0xF1,0x02,
+  0xF2,0x02,0xF3,0x02,0xF4,0x02,0xF5,0x02,0xF6,0x02,0xF7,0x02,0xF8,0x02,0xF9,0x02,
+  0xFA,0x02,0xFB,0x02,0xFC,0x02,0xFD,0x02,0xFE,0x02,0xFF,0x02,0x00,0x03,0x01,0x03,
+  0x02,0x03,0x03,0x03,0x04,0x03,0x05,0x03,0x06,0x03,0x07,0x03,0x08,0x03,0x09,0x03,
+  0x0A,0x03,0xFF,0xFF,0x0B,0x03,0x0C,0x03,0x0D,0x03,0x0E,0x03,0x0F,0x03,0x10,0x03,
+  0x11,0x03,0x12,0x03,0x13,0x03,0xFF,0xFF,0x14,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0x15,0x03,0xFF,0xFF,0xFF,0xFF,0x16,0x03,0xFF,0xFF,0x17,0x03,0xFF,0xFF,
+  0x18,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x19,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x1A,0x03,0x1B,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1C,0x03,
+  0x1D,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1E,0x03,0xFF,0xFF,0xFF,0xFF,0x1F,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x03,0xFF,0xFF,0x21,0x03,0xFF,0xFF,
+  0x22,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x23,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x24,0x03,0x25,0x03,0x26,0x03,0x27,0x03,0x28,0x03,0x29,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2A,0x03,0xFF,0xFF,
+  0x2B,0x03,0xFF,0xFF,0x2C,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2D,0x03,0x2E,0x03,0xFF,0xFF,0x2F,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x03,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x31,0x03,0x32,0x03,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x33,0x03,0x34,0x03,0x35,0x03,0x36,0x03,0x37,0x03,0x38,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x39,0x03,0xFF,0xFF,0xFF,0xFF,0x3A,0x03,0x3B,0x03,0x3C,0x03,
+  0x3D,0x03,0x3E,0x03,0x3F,0x03,0x40,0x03,0x41,0x03,0x42,0x03,0x43,0x03,0x44,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x03,0x46,0x03,0x47,0x03,0x48,0x03,
+  0x49,0x03,0xFF,0xFF,0xFF,0xFF,0x4A,0x03,0x4B,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x4C,0x03,0x4D,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4E,0x03,
+  0xFF,0xFF,0x4F,0x03,0x50,0x03,0x51,0x03,0x52,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x53,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x54,0x03,0x55,0x03,0xFF,0xFF,0xFF,0xFF,0x56,0x03,0x57,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0x03,0x59,0x03,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5A,0x03,0x5B,0x03,0xFF,0xFF,0xFF,0xFF,
+  0x5C,0x03,0x5D,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5F,0x03,0x60,0x03,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x61,0x03,0xFF,0xFF,0x62,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x63,0x03,0x64,0x03,0x65,0x03,0x66,0x03,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x67,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x68,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x69,0x03,0x6A,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6B,0x03,0x6C,0x03,0x6D,0x03,
+  0x6E,0x03,0x6F,0x03,0x70,0x03,0x71,0x03,0x72,0x03,0x73,0x03,0x74,0x03,0x75,0x03,
+  0x76,0x03,0x77,0x03,0x78,0x03,0x79,0x03,0xFF,0xFF,0x7A,0x03,0x7B,0x03,0x7C,0x03,
+  0x7D,0x03,0x7E,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x03,0x80,0x03,0x81,0x03,0x82,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x83,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x84,0x03,0x85,0x03,0x86,0x03,0x87,0x03,0x88,0x03,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x89,0x03,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x8A,0x03,0x8B,0x03,0x8C,0x03,0x8D,0x03,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x8E,0x03,0x8F,0x03,0x90,0x03,0x91,0x03,0x92,0x03,0x93,0x03,
+  0x94,0x03,0x95,0x03,0x96,0x03,0x97,0x03,0x98,0x03,0x99,0x03,0x9A,0x03,0x9B,0x03,
+  0x9C,0x03,0x9D,0x03,0x9E,0x03,0x9F,0x03,0xA0,0x03,0xA1,0x03,0xA2,0x03,0xA3,0x03,
+  0xA4,0x03,0xA5,0x03,0xA6,0x03,0xA7,0x03,0xA8,0x03,0xA9,0x03,0xAA,0x03,0xAB,0x03,
+  0xAC,0x03,0xAD,0x03,0xAE,0x03,0xAF,0x03,0xB0,0x03,0xB1,0x03,0xB2,0x03,0xB3,0x03,
+  0xB4,0x03,0xB5,0x03,0xB6,0x03,0xB7,0x03,0xB8,0x03,0xB9,0x03,0xBA,0x03,0xBB,0x03,
+  0xBC,0x03,0xBD,0x03,0xBE,0x03,0xBF,0x03,0xC0,0x03,0xC1,0x03,0xC2,0x03,0xC3,0x03,
+  0xC4,0x03,0xC5,0x03,0xC6,0x03,0xC7,0x03,0xC8,0x03,0xC9,0x03,0xCA,0x03,0xCB,0x03,
+  0xCC,0x03,0xCD,0x03,0xCE,0x03,0xCF,0x03,0xD0,0x03,0xD1,0x03,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xD2,0x03,0xD3,0x03,0xD4,0x03,0xD5,0x03,0xD6,0x03,0xD7,0x03,
+  0xD8,0x03,0xD9,0x03,0xDA,0x03,0xDB,0x03,0xDC,0x03,0xDD,0x03,0xDE,0x03,0xDF,0x03,
+  0xE0,0x03,0xE1,0x03,0xE2,0x03,0xE3,0x03,0xE4,0x03,0xE5,0x03,0xE6,0x03,0xE7,0x03,
+  0xE8,0x03,0xE9,0x03,0xEA,0x03,0xEB,0x03,0xEC,0x03,0xED,0x03,0xEE,0x03,0xEF,0x03,
+  0xF0,0x03,0xF1,0x03,0xF2,0x03,0xF3,0x03,0xF4,0x03,0xF5,0x03,0xF6,0x03,0xF7,0x03,
+  0xF8,0x03,0xF9,0x03,0xFA,0x03,0xFB,0x03,0xFC,0x03,0xFD,0x03,0xFE,0x03,0xFF,0x03,
+  0x00,0x04,0x01,0x04,0x02,0x04,0x03,0x04,0x04,0x04,0x05,0x04,0x06,0x04,0x07,0x04,
+  0x08,0x04,0x09,0x04,0x0A,0x04,0x0B,0x04,0x0C,0x04,0x0D,0x04,0x0E,0x04,0x0F,0x04,
+  0x10,0x04,0x11,0x04,0x12,0x04,0x13,0x04,0x14,0x04,0x15,0x04,0xFF,0xFF,0xFF,0xFF,
+  0x16,0x04,0x17,0x04,0x18,0x04,0x19,0x04,0x1A,0x04,0x1B,0x04,0x1C,0x04,0x1D,0x04,
+  0x1E,0x04,0x1F,0x04,0x20,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x21,0x04,0xFF,0xFF,
+  0x22,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x23,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x24,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x25,0x04,0xFF,0xFF,0x26,0x04,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x27,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x28,0x04,0xFF,0xFF,
+  0x29,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2A,0x04,0x2B,0x04,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0x2C,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x2D,0x04,0x2E,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2F,0x04,0x30,0x04,0x31,0x04,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x32,0x04,0xFF,0xFF,0x33,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x34,0x04,0xFF,0xFF,0xFF,0xFF,0x35,0x04,0xFF,0xFF,0x36,0x04,
+  0x37,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x38,0x04,0x39,0x04,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3A,0x04,0x3B,0x04,0xFF,0xFF,
+  0xFF,0xFF,0x3C,0x04,0x3D,0x04,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x3E,0x04,0x3F,0x04,0x40,0x04,0x41,0x04,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x42,0x04,0x43,0x04,0x44,0x04,0x45,0x04,0x46,0x04,0x47,0x04,
+  0x48,0x04,0x49,0x04,0x4A,0x04,0x4B,0x04,0x4C,0x04,0x4D,0x04,0x4E,0x04,0x4F,0x04,
+  0x50,0x04,0x51,0x04,0x52,0x04,0x53,0x04,0x54,0x04,0x55,0x04,0x56,0x04,0x57,0x04,
+  0x58,0x04,0x59,0x04,0x5A,0x04,0x5B,0x04,0x5C,0x04,0x5D,0x04,0x5E,0x04,0x5F,0x04,
+  0x60,0x04,0x61,0x04,0x62,0x04,0x63,0x04,0x64,0x04,0x65,0x04,0x66,0x04,0x67,0x04,
+  0x68,0x04,0x69,0x04,0x6A,0x04,0x6B,0x04,0x6C,0x04,0x6D,0x04,0x6E,0x04,0x6F,0x04,
+  0x70,0x04,0x71,0x04,0x72,0x04,0x73,0x04,0x74,0x04,0x75,0x04,0x76,0x04,0x77,0x04,
+  0x78,0x04,0x79,0x04,0x7A,0x04,0x7B,0x04,0x7C,0x04,0x7D,0x04,0x7E,0x04,0x7F,0x04,
+  0x80,0x04,0x81,0x04,0x82,0x04,0x83,0x04,0x84,0x04,0x85,0x04,0x86,0x04,0x87,0x04,
+  0x88,0x04,0x89,0x04,0x8A,0x04,0x8B,0x04,0x8C,0x04,0x8D,0x04,0x8E,0x04,0x8F,0x04,
+  0x90,0x04,0x91,0x04,0x92,0x04,0x93,0x04,0x94,0x04,0x95,0x04,0x96,0x04,0x97,0x04,
+  0x98,0x04,0x99,0x04,0x9A,0x04,0x9B,0x04,0x9C,0x04,0x9D,0x04,0x9E,0x04,0x9F,0x04,
+  0xA0,0x04,0xA1,0x04,0xA2,0x04,0xA3,0x04,0xA4,0x04,0xA5,0x04,0xA6,0x04,0xA7,0x04,
+  0xA8,0x04,0xA9,0x04,0xAA,0x04,0xAB,0x04,0xAC,0x04,0xAD,0x04,0xAE,0x04,0xAF,0x04,
+  0xB0,0x04,0xB1,0x04,0xB2,0x04,0xB3,0x04,0xB4,0x04,0xB5,0x04,0xB6,0x04,0xB7,0x04,
+  0xB8,0x04,0xB9,0x04,0xBA,0x04,0xBB,0x04,0xBC,0x04,0xBD,0x04,0xBE,0x04,0xBF,0x04,
+  0xC0,0x04,0xC1,0x04,0xC2,0x04,0xC3,0x04,0xC4,0x04,0xC5,0x04,0xC6,0x04,0xC7,0x04,
+  0xC8,0x04,0xC9,0x04,0xCA,0x04,0xCB,0x04,0xCC,0x04,0xCD,0x04,0xCE,0x04,0xCF,0x04,
+  0xD0,0x04,0xD1,0x04,0xD2,0x04,0xD3,0x04,0xD4,0x04,0xD5,0x04,0xD6,0x04,0xD7,0x04,
+  0xD8,0x04,0xD9,0x04,0xDA,0x04,0xDB,0x04,0xDC,0x04,0xDD,0x04,0xDE,0x04,0xDF,0x04,
+  0xE0,0x04,0xE1,0x04,0xE2,0x04,0xE3,0x04,0xE4,0x04,0xE5,0x04,0xE6,0x04,0xE7,0x04,
+  0xE8,0x04,0xE9,0x04,0xEA,0x04,0xEB,0x04,0xEC,0x04,0xED,0x04,0xEE,0x04,0xEF,0x04,
+  0xF0,0x04,0xF1,0x04,0xF2,0x04,0xF3,0x04,0xF4,0x04,0xF5,0x04,0xF6,0x04,0xF7,0x04,
+  0xF8,0x04,0xF9,0x04,0xFA,0x04,0xFB,0x04,0xFC,0x04,0xFD,0x04,0xFE,0x04,0xFF,0x04,
+  0x00,0x05,0x01,0x05,0x02,0x05,0x03,0x05,0x04,0x05,0x05,0x05,0x06,0x05,0x07,0x05,
+  0x08,0x05,0x09,0x05,0x0A,0x05,0x0B,0x05,0x0C,0x05,0x0D,0x05,0x0E,0x05,0x0F,0x05,
+  0x10,0x05,0x11,0x05,0x12,0x05,0x13,0x05,0x14,0x05,0x15,0x05,0x16,0x05,0x17,0x05,
+  0x18,0x05,0x19,0x05,0x1A,0x05,0x1B,0x05,0x1C,0x05,0x1D,0x05,0x1E,0x05,0x1F,0x05,
+  0x20,0x05,0x21,0x05,0x22,0x05,0x23,0x05,0x24,0x05,0x25,0x05,0x26,0x05,0x27,0x05,
+  0x28,0x05,0x29,0x05,0x2A,0x05,0x2B,0x05,0x2C,0x05,0x2D,0x05,0x2E,0x05,0x2F,0x05,
+  0x30,0x05,0x31,0x05,0x32,0x05,0x33,0x05,0x34,0x05,0x35,0x05,0x36,0x05,0x37,0x05,
+  0x38,0x05,0x39,0x05,0x3A,0x05,0x3B,0x05,0x3C,0x05,0x3D,0x05,0x3E,0x05,0x3F,0x05,
+  0x40,0x05,0x41,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x42,0x05,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x43,0x05,0x44,0x05,0x45,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x46,0x05,0x47,0x05,0x48,0x05,0x49,0x05,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0x4A,0x05,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4B,0x05,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x66,0x42,0x00,0x42,0x42,0x42,0x00,0x42,0x42,0x66,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x7E,0x24,0x24,0x7E,0x24,0x24,0x24,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x92,0x90,0x90,0x7C,0x12,0x12,0x92,0x7C,
+  0x10,0x10,0x00,0x00,0x00,0x00,0x64,0x94,0x68,0x08,0x10,0x10,0x20,0x2C,0x52,0x4C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x18,0x30,0x4A,0x44,0x44,0x44,0x3A,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x10,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x10,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x7E,0x18,0x24,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x08,0x08,0x10,0x10,0x20,0x20,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x18,0x28,0x08,0x08,0x08,0x08,0x08,0x08,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x02,0x04,0x08,0x10,0x20,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x02,0x1C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x06,0x0A,0x12,0x22,0x42,0x7E,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x7C,0x02,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x20,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x04,0x04,0x08,0x08,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x3C,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x04,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x10,0x10,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x10,0x20,0x40,0x20,0x10,0x08,0x04,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x20,0x10,0x08,0x04,0x08,0x10,0x20,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x04,0x08,0x08,0x00,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x82,0x9E,0xA2,0xA2,0xA2,0xA6,0x9A,0x80,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x7C,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x44,0x42,0x42,0x42,0x42,0x42,0x42,0x44,0x78,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x04,0x04,0x04,0x04,0x04,0x04,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC6,0xAA,0x92,0x92,0x82,0x82,0x82,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x4A,0x3C,
+  0x02,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x24,0x24,0x24,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0x82,0x82,0x92,0x92,0xAA,0xC6,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x24,0x18,0x18,0x24,0x24,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x20,0x20,0x10,0x10,0x08,0x08,0x04,0x04,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x28,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7E,0x00,0x00,0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x00,0x00,0x40,0x40,0x40,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x92,0x92,0x92,0x92,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x5E,0x60,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x0E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x24,0x24,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x92,0x92,0x92,0x92,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x18,0x24,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x04,0x08,0x10,0x20,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x10,0x10,0x10,0x20,0x10,0x10,0x10,0x10,0x0C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x08,0x08,0x08,0x04,0x08,0x08,0x08,0x08,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x62,0x92,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x92,0x90,0x90,0x90,0x92,0x7C,
+  0x10,0x10,0x00,0x00,0x00,0x00,0x18,0x24,0x20,0x20,0x78,0x20,0x20,0x20,0x22,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x38,0x44,0x44,0x44,0x38,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x28,0x10,0x7C,0x10,0x7C,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x00,0x00,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x40,0x30,0x48,0x44,0x44,0x24,0x18,0x04,0x44,
+  0x38,0x00,0x00,0x00,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x81,0x99,0xA5,0xA1,0xA5,0x99,0x81,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x3C,0x44,0x3C,0x00,0x7C,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x24,0x48,0x90,0x48,0x24,0x12,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x02,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x81,0xB9,0xA5,0xB9,0xA9,0xA5,0x81,0x7E,
+  0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x04,0x08,0x10,0x3C,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x18,0x04,0x04,0x38,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x46,0x7A,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x7E,0x92,0x92,0x92,0x92,0x72,0x12,0x12,0x12,0x12,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x10,0x10,0x20,0x00,0x00,0x10,0x30,0x10,0x10,0x10,0x38,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x44,0x44,0x38,0x00,0x7C,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x48,0x24,0x12,0x24,0x48,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x20,0x60,0x20,0x22,0x24,0x08,0x10,0x22,0x46,0x8A,0x1E,
+  0x02,0x02,0x00,0x00,0x00,0x20,0x60,0x20,0x22,0x24,0x08,0x10,0x20,0x4C,0x92,0x04,
+  0x08,0x1E,0x00,0x00,0x00,0xE0,0x10,0x60,0x12,0xE4,0x08,0x10,0x22,0x46,0x8A,0x1E,
+  0x02,0x02,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x10,0x10,0x20,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x90,0x90,0x90,0xFC,0x90,0x90,0x90,0x90,0x9E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x10,0x10,0x20,0x00,0x10,0x08,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x20,0x10,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x44,0x42,0x42,0xF2,0x42,0x42,0x42,0x44,0x78,
+  0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x24,0x18,0x18,0x24,0x42,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x43,0x42,0x46,0x4A,0x52,0x62,0x42,0xC2,0x3C,
+  0x00,0x00,0x00,0x00,0x10,0x08,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x44,0x48,0x7C,0x42,0x42,0x42,0x62,0x5C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x12,0x72,0x9E,0x90,0x90,0x6C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x10,0x10,0x20,0x00,0x00,0x00,0x10,0x08,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x48,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x10,0x28,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x7C,0x00,0x10,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x3C,0x46,0x4A,0x52,0x62,0x42,0xBC,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x3C,0x00,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x02,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x02,0x04,0x03,0x00,0x08,0x10,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x78,0x44,0x42,0x42,0x42,0x42,0x42,0x44,0x78,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x02,0x02,0x02,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x44,0x42,0x42,0xF2,0x42,0x42,0x42,0x44,0x78,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x0F,0x02,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x3C,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x02,0x04,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x08,0x10,0x0C,0x00,0x24,0x18,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x24,0x18,0x00,0x3C,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x10,0x10,0x00,0x3C,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x10,0x10,0x20,0x00,0x04,0x08,0x08,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x18,0x24,0x00,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x0C,0x12,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xFF,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xF0,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x58,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x7C,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x30,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x10,0x20,0x18,0x00,0x00,0x00,0x10,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x10,0x20,0x18,0x00,0x10,0x10,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xE7,0x42,0x42,0x42,0x42,0x42,0x42,0x52,0x52,0xEC,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x00,0xC6,0x42,0x42,0x42,0x42,0x42,0xE2,
+  0x12,0x12,0x0C,0x00,0x0C,0x12,0x00,0x0E,0x04,0x04,0x04,0x04,0x04,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x40,0x40,0x40,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x20,0x40,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x10,0x10,0x20,0x24,0x18,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x48,0x30,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x44,0x44,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x11,0x11,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x60,0xC0,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x18,0x30,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x10,0x10,0x20,0x24,0x18,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x80,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x02,0x02,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x02,0x02,0x0C,0x00,0x3C,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x90,0x90,0x90,0x9C,0x90,0x90,0x90,0x90,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x92,0x92,0x9E,0x90,0x90,0x7C,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7C,0x42,0x42,0x42,0x7C,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x5E,0x60,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x50,0x48,0x44,0x42,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x5E,0x60,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x40,0x40,0x80,0x24,0x18,0x00,0x7C,0x42,0x42,0x42,0x7C,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x5E,0x60,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x42,0x3C,
+  0x10,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x10,0x10,0x20,0x00,0x24,0x18,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x08,0x08,0x10,0x00,0x00,0x00,0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x0E,
+  0x04,0x04,0x08,0x00,0x24,0x18,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x0E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x7C,0x10,0x38,0x10,0x10,0x10,0x0E,
+  0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x08,0x10,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x04,0x03,0x00,0x18,0x24,0x00,0x82,0x82,0x82,0x82,0x92,0x92,0xAA,0xC6,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x82,0x82,0x92,0x92,0x92,0x92,0x7C,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x44,0x44,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7E,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7E,0x04,0x08,0x10,0x20,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x7E,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x7E,0x04,0x08,0x10,0x20,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x7E,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x7E,0x04,0x08,0x10,0x20,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x02,0x02,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x02,0x1E,0x02,0x02,0x02,0x02,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x02,0x7E,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x38,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x90,0x60,0x00,0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x40,0x40,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x02,0x02,0x02,0x00,0x00,0x00,0x7E,0x02,0x04,0x08,0x7E,0x10,0x20,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x04,0x08,0x7C,0x10,0x20,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x04,0x08,0x1C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x30,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x7C,0x00,0x7E,0x90,0x90,0x90,0xFC,0x90,0x90,0x90,0x90,0x9E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x6C,0x12,0x72,0x9E,0x90,0x90,0x6C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x4E,0x42,0x4F,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x4F,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x24,0x18,0x00,0x3C,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x24,0x18,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x40,0x40,0x40,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x08,0x10,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x08,0x10,0x0C,0x00,0x3C,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x08,0x10,0x0C,0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x08,0x10,0x0C,0x00,0x24,0x18,0x00,0x7E,0x04,0x08,0x1C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x7E,0x02,0x04,0x08,0x1C,0x02,0x02,
+  0x42,0x42,0x3C,0x00,0x00,0x00,0x12,0x0C,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x08,0x10,0x00,0x3C,0x42,0x40,0x40,0x4E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x08,0x10,0x00,0x7E,0x90,0x90,0x90,0xFC,0x90,0x90,0x90,0x9E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x6C,0x12,0x72,0x9E,0x90,0x90,0x6C,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3D,0x42,0x46,0x4A,0x52,0x62,0x42,0xC2,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x02,0x3C,0x46,0x4A,0x52,0x62,0x42,0xBC,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x00,0x10,0x10,0x20,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x10,0x10,0x20,0x00,0x00,0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x0E,
+  0x00,0x04,0x04,0x08,0x7C,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x02,0x02,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x02,0x02,0x7E,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x38,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x40,0x40,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x04,0x08,0x1C,0x02,0x02,
+  0x42,0x42,0x3C,0x00,0x08,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x08,0x10,0x0C,0x00,0x32,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x10,0x10,0x00,0x40,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x40,0x80,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x24,0x24,0x66,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x48,0x48,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x0C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x7C,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x28,0x28,0x44,0x44,0x44,0x82,0x82,0xFE,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x04,0x08,0x10,0x20,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x5A,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x28,0x28,0x44,0x44,0x44,0x82,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC6,0xAA,0x92,0x92,0x82,0x82,0x82,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x20,0x10,0x08,0x08,0x10,0x20,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x7C,0x92,0x92,0x92,0x92,0x92,0x92,0x7C,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x24,0x18,0x18,0x24,0x24,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x7C,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x24,0x24,0x66,
+  0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3A,0x46,0x44,0x44,0x44,0x46,0x3A,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x40,0x38,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x02,0x02,0x02,0x00,0x00,0x00,0x08,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x0C,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0x46,0x44,0x44,0x44,0x46,0x3A,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x44,0x48,0x7C,0x42,0x42,0x42,0x42,0x7C,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x28,0x10,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x3E,0x10,0x08,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x38,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x04,0x08,0x10,0x20,0x40,0x40,0x40,0x40,0x3C,
+  0x02,0x02,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x02,0x02,0x02,0x00,0x00,0x00,0x38,0x44,0x44,0x44,0x7C,0x44,0x44,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x0C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x10,0x10,0x28,0x28,0x44,0x44,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x46,0x7A,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x24,0x24,0x18,0x18,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x40,0x3C,0x40,0x40,0x40,0x40,0x3C,
+  0x02,0x02,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x40,0x3C,
+  0x02,0x02,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x44,0x44,0x44,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x0C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x92,0x92,0x92,0x92,0x92,0x7C,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x24,0x18,0x18,0x24,
+  0x24,0x42,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0x92,0x7C,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x82,0x92,0x92,0x92,0x92,0x6C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x0C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x44,0x82,0x92,0x92,0x92,0x92,0x6C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x44,0x44,0x3E,0x04,0xC4,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x7C,0x92,0x92,0x92,0x92,0x92,0x7C,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x24,0x18,0x10,0x30,0x48,0x86,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x40,0x40,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x20,0x40,0x7C,0x40,0x20,0x1E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x04,0x02,0x3E,0x02,0x04,0x78,
+  0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x20,0x20,0x3C,0x22,0x22,0x22,0x22,0x22,0x24,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x78,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x3C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x04,0x04,0x04,0x04,0x04,0x04,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x50,0x90,0x9C,0x92,0x92,0x92,0x92,0x92,0x9C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x90,0x90,0x9C,0xF2,0x92,0x92,0x92,0x92,0x9C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x20,0x20,0x3C,0x22,0x22,0x22,0x22,0x22,0x22,
+  0x00,0x00,0x00,0x00,0x08,0x10,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x10,0x08,0x42,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x7E,
+  0x18,0x18,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x7C,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0xFE,
+  0x82,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x54,0x38,0x54,0x92,0x92,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x02,0x1C,0x02,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x42,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x12,0x22,0x22,0x22,0x22,0x22,0x22,0x22,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC6,0xAA,0x92,0x92,0x82,0x82,0x82,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x7C,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x7C,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x7C,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x24,0x18,0x18,0x24,0x24,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3F,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x7F,
+  0x01,0x01,0x00,0x00,0x00,0x00,0xC0,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0xF2,0x8A,0x8A,0x8A,0x8A,0x8A,0xF2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x02,0x1E,0x02,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x92,0x92,0x92,0x92,0xF2,0x92,0x92,0x92,0x8C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x42,0x42,0x3E,0x0A,0x12,0x22,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x44,0x48,0x7C,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x54,0x38,0x54,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x1C,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x22,0x22,0x22,0x22,0x22,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC6,0xAA,0x92,0x82,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x00,0x00,0x10,0x7C,0x92,0x92,0x92,0x92,0x92,0x7C,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x18,0x24,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3F,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0x92,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0x92,0x7F,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x20,0x3C,0x22,0x22,0x22,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0xF2,0x8A,0x8A,0x8A,0xF2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x78,0x44,0x44,0x44,0x78,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x1E,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x92,0x92,0xF2,0x92,0x92,0x8C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x42,0x42,0x3E,0x12,0x22,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xF0,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x02,0x02,0x0C,0x00,0x00,0x00,0x08,0x10,0x00,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x78,0x40,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x3C,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x90,0x9C,0x92,0x92,0x92,0x9C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x90,0x9C,0xF2,0x92,0x92,0x9C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xF0,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x7E,
+  0x18,0x18,0x00,0x00,0x00,0x00,0x40,0xF0,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x78,0x20,0x20,0x3C,0x22,0x22,0x22,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x82,0x44,0x28,0x38,0x54,0x92,0x92,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x44,0x28,0x38,0x54,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x02,0x02,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x7E,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0xF8,0x40,0x40,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0xF8,0x40,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,
+  0x02,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x78,0x44,0x44,0x44,
+  0x04,0x08,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x54,0x38,0x54,0x92,0x92,0x92,0x93,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x54,0x38,0x54,0x92,0x93,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x02,0x1C,0x02,0x02,0x42,0x42,0x3C,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x1C,0x02,0x42,0x3C,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x43,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x44,0x48,0x70,0x48,0x44,0x43,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x42,0x42,0x54,0x58,0x70,0x70,0x58,0x54,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x54,0x58,0x70,0x58,0x54,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x43,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x7E,0x42,0x42,0x43,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x47,0x44,0x44,0x44,0x7C,0x44,0x44,0x44,0x44,0x44,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x47,0x44,0x44,0x7C,0x44,0x44,0x44,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x40,0x40,0x40,0x40,0x42,0x42,0x3C,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x40,0x40,0x40,0x42,0x3C,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x28,0x10,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x7C,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x28,0x10,
+  0x7C,0x10,0x10,0x00,0x00,0x00,0x42,0x42,0x24,0x24,0x18,0x18,0x24,0x24,0x42,0x43,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x24,0x18,0x24,0x42,0x43,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x03,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x3E,0x02,0x02,0x03,
+  0x01,0x01,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x4A,0x4A,0x3E,0x0A,0x0A,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x4A,0x4A,0x3E,0x0A,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x92,0x92,0x92,0x54,0x38,0x54,0x92,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x92,0x92,0x54,0x38,0x54,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x02,0x3E,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x90,0x90,0x90,0xFC,0x90,0x90,0x90,0x90,0x9E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0x12,0x72,0x9E,0x90,0x90,0x6C,
+  0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x18,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x02,0x02,0x7E,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x02,0x02,0x7E,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x02,0x02,0x7E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x02,0x02,0x7E,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x92,0x92,0x92,0x54,0x38,0x54,0x92,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x92,0x92,0x54,0x38,0x54,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x02,0x1C,0x02,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x02,0x1C,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x46,0x4A,0x52,0x62,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x42,0x7E,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x42,0x7E,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x02,0x02,0x1E,0x02,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x3C,0x42,0x02,0x1E,0x02,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x12,0x24,0x00,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x24,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0x42,0x42,0x42,0x3E,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x48,0x48,0x00,0x82,0x82,0x82,0xF2,0x8A,0x8A,0x8A,0x8A,0xF2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x00,0x82,0x82,0xF2,0x8A,0x8A,0x8A,0xF2,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x22,0x22,0x14,0x28,0x44,0x44,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x7F,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x08,0x08,0x08,0x08,0x08,0x14,0x24,0x42,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x02,0x02,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x08,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x08,0x08,0x08,0x08,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x00,0x00,0x00,0x7C,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x40,0x40,0x7E,0x02,0x02,0x02,0x02,0x04,0x08,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xDC,0x62,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x4E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x22,0x22,0x22,0x14,0x14,0x18,0x60,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x32,0x02,0x02,0x02,0x02,0x02,
+  0x02,0x02,0x02,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x32,0x02,0x02,0x02,0x02,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x22,0x24,0x18,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x00,0x00,0x00,0x42,0x42,0x22,0x24,0x18,0x10,0x08,0x08,0x04,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x42,0x42,0x44,0x48,0x48,0x48,0x48,
+  0x40,0x40,0x40,0x00,0x00,0x00,0x7C,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,0x92,0x92,0x92,0xA2,0xC2,0x82,0x84,0xF8,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x44,0x42,0x42,0x42,0x42,0x42,0x42,0x44,0x78,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x02,0x02,0x02,0x3E,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x08,0x08,0x00,0x00,0x00,0x42,0x44,0x48,0x50,0x60,0x60,0x50,0x48,0x44,0x42,
+  0x00,0x3C,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x42,0x44,0x48,0x70,0x48,0x44,0x42,
+  0x00,0x3C,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x10,0x10,0x00,0x10,0x10,0x82,0xC6,0xAA,0x92,0x92,0x82,0x82,0x82,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0xFC,0x92,0x92,0x92,0x92,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xC6,0xAA,0x92,0x92,0x82,0x82,0x82,0x82,0x82,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x92,0x92,0x92,0x92,0x92,0x92,
+  0x00,0x10,0x10,0x00,0x10,0x10,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x62,0x52,0x4A,0x46,0x42,0x42,0x42,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x10,0x10,0x00,0x00,0x00,0xFE,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x0E,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x40,0x7E,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x10,0x10,0x00,0x32,0x4C,0x00,0x7E,0x40,0x40,0x40,0x78,0x40,0x40,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x3C,0x42,0x42,0x7E,0x40,0x40,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x10,0x10,0x00,0x30,0x10,0x10,0x10,0x10,0x10,0x38,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x00,0x08,0x08,0x00,0x64,0x98,0x00,0x82,0x82,0x44,0x44,0x28,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x3E,
+  0x02,0x02,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x7E,0x00,0x7E,0x00,0x08,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,
+  0x10,0x00,0x00,0x00,0x00,0x10,0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x12,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x12,0x12,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,
+  0x48,0x00,0x00,0x00,0x00,0x48,0x48,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,0x7C,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x3C,0x3C,0x18,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x92,0x92,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xA8,0x50,0x10,0x20,0x20,0x40,0x54,0xAA,0x94,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x10,0x20,0x10,0x08,0x04,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x08,0x04,0x08,0x10,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0x24,0x24,
+  0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x24,0x24,0x18,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x00,0x30,0x10,0x10,0x10,0x38,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x0C,0x14,0x3E,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x38,0x20,0x38,0x04,0x04,0x38,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x18,0x20,0x38,0x24,0x24,0x18,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x3C,0x04,0x08,0x08,0x10,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x24,0x24,0x18,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x1C,0x04,0x18,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x10,0x10,0x10,0x08,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x08,0x08,0x08,0x10,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x24,0x24,0x24,0x24,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x24,0x24,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x30,0x10,0x10,0x10,
+  0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x04,0x08,0x10,
+  0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x18,0x04,0x04,
+  0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x0C,0x14,0x3E,0x04,
+  0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x20,0x38,0x04,0x04,
+  0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x20,0x38,0x24,0x24,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x04,0x08,0x08,0x10,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x18,0x24,0x24,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x1C,0x04,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x10,0x10,0x10,
+  0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x08,0x08,0x08,
+  0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x04,0x1C,0x24,
+  0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x3C,0x20,
+  0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x24,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x28,0x10,0x28,
+  0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x04,0x3C,0x24,
+  0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x38,0x24,0x24,0x24,
+  0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x24,0x28,0x30,0x28,
+  0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x10,0x10,0x10,0x10,0x10,
+  0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x54,0x54,0x54,
+  0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x24,0x24,0x24,
+  0x38,0x20,0x20,0x00,0x00,0x00,0xF0,0x88,0x88,0x88,0xF4,0x84,0x8E,0x84,0x84,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x8A,0x8A,0xAA,0xAA,0xAA,0xAA,0xA2,0xA2,0xBC,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x22,0x40,0xF8,0x40,0xF8,0x40,0x22,0x1C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x10,0x10,0x1C,0x70,0x1C,0x70,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x52,0x52,0x50,0x50,0x50,0x50,0x52,0x52,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xF0,0x40,0x7C,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x62,0x52,0x6A,0x56,0x4A,0x46,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x96,0x96,0x96,0xD0,0xF0,0xF0,0xB0,0x96,0x90,0x96,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x5A,0x3C,
+  0x06,0x00,0x00,0x00,0x00,0x00,0xF8,0xA4,0xA4,0xA4,0xA4,0xB8,0xA8,0xB4,0xAA,0xE6,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x55,0x55,0x51,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x06,0x0A,0x14,0x28,0x50,0x60,0x40,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x24,0x24,0x66,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x22,0x22,0x34,0x58,0x88,0x88,0x84,0x44,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xFE,0x40,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x54,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0xFE,0x04,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x54,0x38,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x42,0xFF,0x42,0x24,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x54,0x10,0x10,0x10,0x10,0x54,0x38,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0x42,0xFE,0x42,0x22,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x88,0x84,0xFE,0x84,0x88,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x54,0x10,0x10,0x10,0x54,0x38,0x10,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x22,0x42,0xFE,0x40,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x88,0x84,0xFE,0x04,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x22,0x42,0xFE,0x40,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x30,0x50,0x92,0x82,0x82,0x44,0x38,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x40,0xFE,0x00,0xFE,0x04,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x04,0xFE,0x00,0xFE,0x40,0x20,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x7E,0xC0,0x7E,0x20,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x6C,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xFC,0x06,0xFC,0x08,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x6C,0x38,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x7E,0xC3,0x7E,0x24,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x6C,0x28,0x28,0x28,0x28,0x6C,0x38,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x82,0x7C,0x44,0x44,0x28,0x28,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x02,0x02,0x02,0x7E,0x02,0x02,0x02,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x7E,0x0A,0x0A,0x12,0x7E,0x12,0x22,0x22,0x7E,
+  0x40,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x7C,0x8A,0x92,0x92,0xA2,0x7C,0x40,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x28,0x28,0x44,0x44,0x44,0x82,0x82,0xFE,
+  0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x82,0x82,0x44,0x44,0x44,0x28,0x28,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x20,0x40,0x40,0x7E,0x40,0x40,0x20,0x1E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x1E,0x24,0x44,0x48,0x7E,0x48,0x50,0x30,0x3E,
+  0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x20,0x40,0x7E,0x40,0x20,0x1E,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x04,0x02,0x02,0x7E,0x02,0x02,0x04,0x78,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x78,0x24,0x22,0x12,0x7E,0x12,0x0A,0x0C,0x7C,
+  0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x04,0x02,0x7E,0x02,0x04,0x78,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x10,0x10,0x7C,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x00,0x10,0x10,0x7C,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x06,0x04,0x04,0x04,0x04,0x44,0x44,0x44,0x24,0x14,0x0C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x92,0x92,0x92,0x7C,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x40,0x40,0x7E,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x28,0x28,0x44,0x44,0x82,0x82,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x82,0x44,0x44,0x28,0x28,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x4C,0x00,0x32,0x4C,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x7E,0x08,0x10,0x7E,0x40,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x08,0x10,0x20,0x10,0x08,0x04,0x00,0x3E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x10,0x08,0x04,0x08,0x10,0x20,0x00,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x12,0x24,0x48,0x90,0x48,0x24,0x12,0x09,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x48,0x24,0x12,0x09,0x12,0x24,0x48,0x90,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x40,0x40,0x40,0x3E,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x02,0x02,0x02,0x02,0x02,0x7C,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x40,0x40,0x40,0x40,0x40,0x3E,0x00,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x02,0x02,0x02,0x02,0x02,0x7C,0x00,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFE,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x3C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x04,0x7C,0x8A,0x92,0x92,0xA2,0x7C,0x40,0x80,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x28,0x44,0x82,0x82,0x82,0x82,0xFE,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x40,0x40,0x40,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x40,0x7E,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x12,0x12,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x90,0x90,0x60,
+  0x00,0x00,0x00,0x00,0x04,0x08,0x10,0x10,0x20,0x20,0x20,0x40,0x40,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x20,0x20,0x20,
+  0x10,0x10,0x08,0x04,0x40,0x20,0x10,0x10,0x08,0x08,0x08,0x04,0x04,0x04,0x04,0x04,
+  0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x08,0x08,0x08,
+  0x10,0x10,0x20,0x40,0x7C,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,
+  0x40,0x40,0x40,0x7C,0x7C,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x04,0x04,0x04,0x7C,0x0E,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0xC0,0xC0,0x20,0x20,0x20,
+  0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+  0x20,0x20,0x10,0x0E,0xE0,0x10,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+  0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x06,0x06,0x08,0x08,0x08,
+  0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+  0x08,0x08,0x10,0xE0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xFF,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x88,0x88,0xF8,0x88,0x88,0x88,0x00,0x1F,0x04,0x04,0x04,
+  0x04,0x04,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0xF8,0x00,0x1F,0x10,0x1C,0x10,
+  0x10,0x10,0x00,0x00,0x00,0x88,0x88,0x50,0x50,0x20,0x20,0x00,0x1F,0x04,0x04,0x04,
+  0x04,0x04,0x00,0x00,0x00,0xF8,0x80,0xE0,0x80,0x80,0x80,0x00,0x1F,0x10,0x1C,0x10,
+  0x10,0x10,0x00,0x00,0x00,0x70,0x88,0x80,0x80,0x88,0x70,0x00,0x1E,0x11,0x11,0x1E,
+  0x12,0x11,0x00,0x00,0x00,0x88,0xC8,0xA8,0x98,0x88,0x88,0x00,0x10,0x10,0x10,0x10,
+  0x10,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x00,0x10,0x10,0x10,0x00,0x10,0x10,0x10,0x00,
+  0x10,0x10,0x10,0x00,0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x00,
+  0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0xF0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x1F,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1F,0x1F,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF8,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xF8,0xF8,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF8,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1F,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0xF0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xF8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0xFF,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0xF8,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x1F,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0xFF,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xF8,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0x1F,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x10,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x20,0x2F,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x10,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x08,0xE8,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x10,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x3F,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x2F,0x20,0x3F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x10,0xF0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xF8,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0xE8,0x08,0xF8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x1F,0x10,0x1F,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x2F,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x2F,0x20,0x2F,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x10,0x10,0x10,0x10,0x10,0x10,0xF0,0x10,0xF0,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xE8,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xE8,0x08,0xE8,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xFF,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xEF,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x00,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x28,0x28,0x28,0x28,0x28,0x28,0xEF,0x00,0xFF,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0xFF,0x10,0xFF,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xFF,0x28,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0x28,0xEF,0x00,0xEF,0x28,0x28,0x28,
+  0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x08,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x20,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x20,0xC0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x08,0x07,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x01,0x01,0x02,0x02,0x04,0x04,0x08,0x08,0x10,0x10,0x20,0x20,
+  0x40,0x40,0x80,0x80,0x80,0x80,0x40,0x40,0x20,0x20,0x10,0x10,0x08,0x08,0x04,0x04,
+  0x02,0x02,0x01,0x01,0x81,0x81,0x42,0x42,0x24,0x24,0x18,0x18,0x18,0x18,0x24,0x24,
+  0x42,0x42,0x81,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x1F,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x10,0x10,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,0xFE,
+  0xFE,0xFE,0xFE,0xFE,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
+  0xFC,0xFC,0xFC,0xFC,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0xF0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,
+  0xE0,0xE0,0xE0,0xE0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+  0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+  0x80,0x80,0x80,0x80,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0x88,0x22,0x88,0x22,0x88,0x22,0x88,0x22,0x88,0x22,0x88,0x22,
+  0x88,0x22,0x88,0x22,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,0xAA,0x55,
+  0xAA,0x55,0xAA,0x55,0xEE,0xBB,0xEE,0xBB,0xEE,0xBB,0xEE,0xBB,0xEE,0xBB,0xEE,0xBB,
+  0xEE,0xBB,0xEE,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xF0,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,
+  0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,
+  0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x7E,0x7E,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x38,0x38,0x7C,0x7C,0xFE,0xFE,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0xFC,0xF0,0xC0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0xFC,0xF0,0xC0,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0x7C,0x7C,0x38,0x38,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0xFF,0x3F,0x0F,0x03,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0xFF,0x3F,0x0F,0x03,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x7C,0xFE,0x7C,0x38,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x28,0x44,0x82,0x44,0x28,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x24,0x24,0x18,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x3C,0x3C,0x18,0x00,0x00,
+  0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xC3,0xC3,0xE7,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xDB,0xDB,0xE7,0xFF,0xFF,
+  0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x7C,0x82,0xAA,0x82,0x82,0xBA,0x92,0x82,0x82,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0xFE,0xD6,0xFE,0xFE,0xC6,0xEE,0xFE,0xFE,0x7C,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x92,0x54,0x38,0xEE,0x38,0x54,0x92,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x44,0x44,0x44,0x44,0x38,0x10,0x7C,0x10,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x06,0x0A,0x12,0x38,0x44,0x44,0x44,0x44,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x10,0x38,0x7C,0xFE,0xFE,0x7C,0x10,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x38,0x10,0x54,0xFE,0xFE,0x54,0x10,0x38,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0xFE,0xFE,0xFE,0xFE,0x7C,0x38,0x10,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x38,0x7C,0xFE,0x7C,0x38,0x10,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x22,0x3E,0x20,0x20,0x20,0x20,0x20,0x20,0xC0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x42,0x7E,0x42,0x42,0x42,0x42,0x42,0x42,0x44,
+  0x80,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x04,0x04,0x88,0x88,0x50,0x50,0x20,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x06,0x06,0xCC,0xCC,0x78,0x78,0x30,0x30,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x44,0x28,0x18,0x18,0x14,0x22,0x20,0x40,0x40,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0xCC,0x78,0x38,0x38,0x3C,0x66,0x60,0xC0,0xC0,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0x10,0x10,0x20,0x20,0x10,0x10,0x08,0x08,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x10,0x10,0x08,0x08,0x10,0x10,0x20,0x20,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x12,0x24,0x24,0x48,0x48,0x24,0x24,0x12,0x12,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x48,0x24,0x24,0x12,0x12,0x24,0x24,0x48,0x48,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x40,0x40,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x04,0x04,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,0x00,0x44,0x44,0x00,
+  0x00,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x42,0x00,0x00,0x00,0x42,0x42,
+  0x00,0x00,0x00,0x00,0x80,0x80,0x88,0x9C,0xAA,0x88,0x88,0x88,0x10,0x20,0x40,0x80,
+  0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x80,0x80,0xF8,0x00,0x11,0x19,0x15,0x13,
+  0x11,0x11,0x00,0x00,0x00,0x38,0x44,0x44,0x44,0x44,0xFE,0xFE,0xEE,0xC6,0xEE,0xFE,
+  0xFE,0xFE,0x00,0x00,0x80,0xC0,0xE0,0xF0,0xF8,0xFC,0xFE,0xFF,0xFF,0xFE,0xFC,0xF8,
+  0xF0,0xE0,0xC0,0x80,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01,0x01,0x02,0x04,0x08,
+  0x10,0x20,0x40,0x80,0x01,0x03,0x07,0x0F,0x1F,0x3F,0x7F,0xFF,0xFF,0x7F,0x3F,0x1F,
+  0x0F,0x07,0x03,0x01,0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80,0x80,0x40,0x20,0x10,
+  0x08,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x0C,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x44,0x44,0x38,0x00,0x00,0x00,0x7E,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x42,0x7E,
+  0x00,0x00,0x00,0x00,
+};
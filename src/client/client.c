@@ -7,14 +7,15 @@
 #include <stdint.h>
 #include "sqwslib.h"
 
-#define WIN_IDX 0
 #define INIT_WIN_W 320
 #define INIT_WIN_H 240
 #define SQUARE_SIZE 20
 #define SPEED 2
 #define FRAME_DELAY 50000
 
-int main() {
+int main(int argc, char **argv) {
+    bool fullscreen = argc > 1 && !strcmp(argv[1], "-f");
+
     SqwsClient *client = sqws_connect();
     if (!client) {
         fprintf(stderr, "failed to connect\n");
@@ -23,7 +24,7 @@ int main() {
     printf("connected!\n");
 
     uint8_t color[4] = {100, 100, 255, 255};
-    SqwsWindow *win = sqws_create_window(client, WIN_IDX, "example", 100, 100, INIT_WIN_W, INIT_WIN_H, color);
+    SqwsWindow *win = sqws_create_window_shm(client, "example", 100, 100, INIT_WIN_W, INIT_WIN_H, color);
     if (!win || win->info.canvas_w != INIT_WIN_W || win->info.canvas_h != INIT_WIN_H) {
         fprintf(stderr, "create failed or invalid size\n");
         if (win) sqws_destroy_window(win);
@@ -31,9 +32,11 @@ int main() {
         return 1;
     }
     printf("created: (%zu x %zu)\n", (size_t)win->info.canvas_w, (size_t)win->info.canvas_h);
+    if (fullscreen) sqws_set_fullscreen(win, true);
 
     int pos = 0;
     int dir = 1;
+    int prev_pos = -1;
     unsigned char key = 0;
 
     while (key == 0) {
@@ -57,9 +60,25 @@ int main() {
             }
         }
 
-        sqws_draw_window(win);
+        if (prev_pos < 0) {
+            sqws_draw_window(win);
+        } else {
+            // only the strip the square moved through changed
+            int x0 = prev_pos < pos ? prev_pos : pos;
+            SqwsRect dirty = {x0, y_start, SQUARE_SIZE + abs(pos - prev_pos), SQUARE_SIZE};
+            sqws_draw_window_rects(win, &dirty, 1);
+        }
+        prev_pos = pos;
 
-        key = sqws_get_key(win);
+        // the server pushes input as it happens, take what came in meanwhile
+        SqwsEvent ev;
+        int r;
+        while ((r = sqws_poll_event(client, &ev)) > 0) {
+            if (ev.type == SQWS_MSG_KEY && ev.value == 1) key = ev.code;
+            // resized or maximized, the next frame is drawn at the new size
+            if (ev.type == SQWS_MSG_CONFIGURE && sqws_ack_configure(win, &ev) == 0) prev_pos = -1;
+        }
+        if (r < 0) break;
         usleep(FRAME_DELAY);
         
         pos += dir * SPEED;
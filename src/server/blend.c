@@ -0,0 +1,281 @@
+#include "draw.h"
+#include "sqwsproto.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_KERNELS 1
+#endif
+
+// span blending: dst = (src * a + dst * (255 - a)) / 255 per colour channel,
+// alpha of the result is 255, a == 0 leaves dst alone and a == 255 copies src.
+// every kernel is bit exact with blend_pixel, the division is done as
+// (x * 0x8081) >> 23 which equals x / 255 for all x <= 255 * 255
+
+static void blend_span_solid_scalar(uint32_t *dst, int n, const unsigned char *color) {
+    for (int i = 0; i < n; i++)
+        blend_pixel((unsigned char *)&dst[i], color);
+}
+
+static void blend_span_argb_scalar(uint32_t *dst, const uint32_t *src, int n) {
+    for (int i = 0; i < n; i++)
+        blend_pixel((unsigned char *)&dst[i], (const unsigned char *)&src[i]);
+}
+
+// alpha test: copy the pixels whose alpha has the top bit set
+static void blit_span_alpha_test_scalar(uint32_t *dst, const uint32_t *src, int n) {
+    for (int i = 0; i < n; i++)
+        if (src[i] & 0x80000000u) dst[i] = src[i];
+}
+
+void (*blend_span_solid)(uint32_t *dst, int n, const unsigned char *color) = blend_span_solid_scalar;
+void (*blend_span_argb)(uint32_t *dst, const uint32_t *src, int n) = blend_span_argb_scalar;
+void (*blit_span_alpha_test)(uint32_t *dst, const uint32_t *src, int n) = blit_span_alpha_test_scalar;
+
+// rects bigger than this won't stay in cache anyway, so opaque blits skip it
+#define STREAM_THRESHOLD (8u << 20)
+static bool use_streaming = false;
+
+#ifdef HAVE_X86_KERNELS
+
+__attribute__((target("sse2")))
+static inline __m128i div255_sse2(__m128i x) {
+    return _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7);
+}
+
+__attribute__((target("sse2")))
+static void blend_span_solid_sse2(uint32_t *dst, int n, const unsigned char *color) {
+    unsigned a = color[3];
+    if (a == 255 || a == 0) {
+        blend_span_solid_scalar(dst, n, color);
+        return;
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha_bits = _mm_set1_epi32((int)0xff000000);
+    const __m128i inv_a = _mm_set1_epi16(255 - a);
+    // src * a is the same for every pixel
+    __m128i src = _mm_unpacklo_epi8(_mm_set1_epi32(*(const int32_t *)color), zero);
+    __m128i src_a = _mm_mullo_epi16(src, _mm_set1_epi16(a));
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i lo = _mm_unpacklo_epi8(d, zero);
+        __m128i hi = _mm_unpackhi_epi8(d, zero);
+        lo = div255_sse2(_mm_add_epi16(src_a, _mm_mullo_epi16(lo, inv_a)));
+        hi = div255_sse2(_mm_add_epi16(src_a, _mm_mullo_epi16(hi, inv_a)));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_packus_epi16(lo, hi), alpha_bits));
+    }
+    blend_span_solid_scalar(dst + i, n - i, color);
+}
+
+// replicates each pixel's alpha into all four 16-bit lanes of that pixel
+__attribute__((target("sse2")))
+static inline __m128i splat_alpha_sse2(__m128i px16) {
+    px16 = _mm_shufflelo_epi16(px16, _MM_SHUFFLE(3, 3, 3, 3));
+    return _mm_shufflehi_epi16(px16, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+__attribute__((target("sse2")))
+static void blend_span_argb_sse2(uint32_t *dst, const uint32_t *src, int n) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(255);
+    const __m128i alpha_bits = _mm_set1_epi32((int)0xff000000);
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+
+        __m128i s_lo = _mm_unpacklo_epi8(s, zero), s_hi = _mm_unpackhi_epi8(s, zero);
+        __m128i d_lo = _mm_unpacklo_epi8(d, zero), d_hi = _mm_unpackhi_epi8(d, zero);
+        __m128i a_lo = splat_alpha_sse2(s_lo), a_hi = splat_alpha_sse2(s_hi);
+
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(s_lo, a_lo), _mm_mullo_epi16(d_lo, _mm_sub_epi16(c255, a_lo)));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(s_hi, a_hi), _mm_mullo_epi16(d_hi, _mm_sub_epi16(c255, a_hi)));
+        __m128i out = _mm_or_si128(_mm_packus_epi16(div255_sse2(lo), div255_sse2(hi)), alpha_bits);
+
+        // fully transparent pixels keep dst untouched, alpha included
+        __m128i transparent = _mm_cmpeq_epi32(_mm_and_si128(s, alpha_bits), zero);
+        out = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, out));
+        _mm_storeu_si128((__m128i *)(dst + i), out);
+    }
+    blend_span_argb_scalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static void blit_span_alpha_test_sse2(uint32_t *dst, const uint32_t *src, int n) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        __m128i keep = _mm_srai_epi32(s, 31);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(keep, s), _mm_andnot_si128(keep, d)));
+    }
+    blit_span_alpha_test_scalar(dst + i, src + i, n - i);
+}
+
+// copies a row with non-temporal stores, the caller issues the fence
+__attribute__((target("sse2")))
+static void copy_span_stream_sse2(uint32_t *dst, const uint32_t *src, int n) {
+    int i = 0;
+    for (; i < n && ((uintptr_t)(dst + i) & 15); i++) dst[i] = src[i];
+    for (; i + 4 <= n; i += 4)
+        _mm_stream_si128((__m128i *)(dst + i), _mm_loadu_si128((const __m128i *)(src + i)));
+    for (; i < n; i++) dst[i] = src[i];
+}
+
+__attribute__((target("sse2")))
+static void stream_fence(void) {
+    _mm_sfence();
+}
+
+__attribute__((target("avx2")))
+static inline __m256i div255_avx2(__m256i x) {
+    return _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7);
+}
+
+__attribute__((target("avx2")))
+static void blend_span_solid_avx2(uint32_t *dst, int n, const unsigned char *color) {
+    unsigned a = color[3];
+    if (a == 255 || a == 0) {
+        blend_span_solid_scalar(dst, n, color);
+        return;
+    }
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alpha_bits = _mm256_set1_epi32((int)0xff000000);
+    const __m256i inv_a = _mm256_set1_epi16(255 - a);
+    __m256i src = _mm256_unpacklo_epi8(_mm256_set1_epi32(*(const int32_t *)color), zero);
+    __m256i src_a = _mm256_mullo_epi16(src, _mm256_set1_epi16(a));
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        __m256i lo = _mm256_unpacklo_epi8(d, zero);
+        __m256i hi = _mm256_unpackhi_epi8(d, zero);
+        lo = div255_avx2(_mm256_add_epi16(src_a, _mm256_mullo_epi16(lo, inv_a)));
+        hi = div255_avx2(_mm256_add_epi16(src_a, _mm256_mullo_epi16(hi, inv_a)));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_or_si256(_mm256_packus_epi16(lo, hi), alpha_bits));
+    }
+    blend_span_solid_sse2(dst + i, n - i, color);
+}
+
+__attribute__((target("avx2")))
+static void blend_span_argb_avx2(uint32_t *dst, const uint32_t *src, int n) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i c255 = _mm256_set1_epi16(255);
+    const __m256i alpha_bits = _mm256_set1_epi32((int)0xff000000);
+    const __m256i splat = _mm256_setr_epi8(
+        6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15,
+        6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15);
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+
+        __m256i s_lo = _mm256_unpacklo_epi8(s, zero), s_hi = _mm256_unpackhi_epi8(s, zero);
+        __m256i d_lo = _mm256_unpacklo_epi8(d, zero), d_hi = _mm256_unpackhi_epi8(d, zero);
+        __m256i a_lo = _mm256_shuffle_epi8(s_lo, splat), a_hi = _mm256_shuffle_epi8(s_hi, splat);
+
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(s_lo, a_lo), _mm256_mullo_epi16(d_lo, _mm256_sub_epi16(c255, a_lo)));
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(s_hi, a_hi), _mm256_mullo_epi16(d_hi, _mm256_sub_epi16(c255, a_hi)));
+        __m256i out = _mm256_or_si256(_mm256_packus_epi16(div255_avx2(lo), div255_avx2(hi)), alpha_bits);
+
+        __m256i transparent = _mm256_cmpeq_epi32(_mm256_and_si256(s, alpha_bits), zero);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_blendv_epi8(out, d, transparent));
+    }
+    blend_span_argb_sse2(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void blit_span_alpha_test_avx2(uint32_t *dst, const uint32_t *src, int n) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst + i));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_blendv_epi8(d, s, _mm256_srai_epi32(s, 31)));
+    }
+    blit_span_alpha_test_sse2(dst + i, src + i, n - i);
+}
+
+#endif // HAVE_X86_KERNELS
+
+void blit_rect(unsigned char *dst, int dst_pitch, const unsigned char *src, int src_pitch,
+               int w, int h, int surface_mode) {
+    if (w <= 0 || h <= 0) return;
+
+    switch (surface_mode) {
+        case SQWS_SURFACE_BLEND:
+            for (int y = 0; y < h; y++, dst += dst_pitch, src += src_pitch)
+                blend_span_argb((uint32_t *)dst, (const uint32_t *)src, w);
+            return;
+
+        case SQWS_SURFACE_ALPHA_TEST:
+            for (int y = 0; y < h; y++, dst += dst_pitch, src += src_pitch)
+                blit_span_alpha_test((uint32_t *)dst, (const uint32_t *)src, w);
+            return;
+
+        default:
+            break;
+    }
+
+#ifdef HAVE_X86_KERNELS
+    if (use_streaming && (size_t)w * h * 4 >= STREAM_THRESHOLD) {
+        for (int y = 0; y < h; y++, dst += dst_pitch, src += src_pitch)
+            copy_span_stream_sse2((uint32_t *)dst, (const uint32_t *)src, w);
+        stream_fence();
+        return;
+    }
+#endif
+    // one copy when both sides are contiguous, e.g. a maximized window
+    if (dst_pitch == src_pitch && src_pitch == w * 4) {
+        memcpy(dst, src, (size_t)w * h * 4);
+        return;
+    }
+    for (int y = 0; y < h; y++, dst += dst_pitch, src += src_pitch)
+        memcpy(dst, src, (size_t)w * 4);
+}
+
+void blend_init(void) {
+#ifdef HAVE_X86_KERNELS
+    __builtin_cpu_init();
+    use_streaming = __builtin_cpu_supports("sse2");
+    if (__builtin_cpu_supports("avx2")) {
+        blend_span_solid = blend_span_solid_avx2;
+        blend_span_argb = blend_span_argb_avx2;
+        blit_span_alpha_test = blit_span_alpha_test_avx2;
+    } else if (__builtin_cpu_supports("sse2")) {
+        blend_span_solid = blend_span_solid_sse2;
+        blend_span_argb = blend_span_argb_sse2;
+        blit_span_alpha_test = blit_span_alpha_test_sse2;
+    }
+#endif
+    // SQWS_BLEND=scalar|sse2 caps the kernels, e.g. to compare them in benchmarks
+    const char *cap = getenv("SQWS_BLEND");
+    if (cap && !strcmp(cap, "scalar")) {
+        blend_span_solid = blend_span_solid_scalar;
+        blend_span_argb = blend_span_argb_scalar;
+        blit_span_alpha_test = blit_span_alpha_test_scalar;
+        use_streaming = false;
+    }
+#ifdef HAVE_X86_KERNELS
+    else if (cap && !strcmp(cap, "sse2")) {
+        blend_span_solid = blend_span_solid_sse2;
+        blend_span_argb = blend_span_argb_sse2;
+        blit_span_alpha_test = blit_span_alpha_test_sse2;
+    }
+#endif
+}
+
+const char *blend_kernel_name(void) {
+#ifdef HAVE_X86_KERNELS
+    if (blend_span_argb == blend_span_argb_avx2) return "avx2";
+    if (blend_span_argb == blend_span_argb_sse2) return "sse2";
+#endif
+    return "scalar";
+}
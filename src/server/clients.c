@@ -0,0 +1,619 @@
+#define _GNU_SOURCE
+#include "wm.h"
+#include "sqwsproto.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// client sockets are non-blocking. whatever arrives is appended to a receive
+// buffer and parsed from there, as many commands per read as came in, a
+// command that is only partly there stays in the buffer until the rest comes
+// in. pixel payloads are copied from the buffer into the canvas as they
+// come, long runs of them are received straight into the canvas, across as
+// many loop iterations as it takes
+//
+// each client gets a budget of bytes and commands per loop iteration, so a
+// client uploading a big canvas or flooding small commands can't keep the
+// server from handling input, other clients and frames
+
+#define CLIENT_READ_BUDGET (4u << 20)
+#define CLIENT_CMD_BUDGET 1024
+
+// pixel runs at least this long are received straight into the canvas
+#define DIRECT_RECV_MIN 4096
+
+// the largest command that is parsed from the buffer, the header and rect
+// list of SQWS_CMD_DRAW_RECTS with all rects
+#define MAX_CMD_SIZE (sizeof(sqws_cmd_header_t) + SQWS_MAX_RECTS * 16)
+
+// windows belong to the client that created them and are known to it by a
+// small id the server hands out. ids map to slots in windows[] through the
+// client's table and slots map back to owner and id in the window, both
+// O(1). a slot's generation changes whenever it is reused, so a stale id, say
+// of a window closed with its close button, never reaches someone else's
+// window
+
+static void client_close_fds(client_t *c) {
+    for (int i = 0; i < c->nfds; i++) close(c->passed_fds[i]);
+    c->nfds = 0;
+}
+
+// the window id stands for, NULL if it is gone
+static window_t *client_window(const client_t *c, int id) {
+    int slot = c->win_slot[id] - 1;
+    if (slot < 0 || slot >= window_slots || !windows[slot].used || windows[slot].gen != c->win_gen[id]) return NULL;
+    return &windows[slot];
+}
+
+// a free id and a slot for a new window of c, false if there is none
+static bool client_new_window(client_t *c, int *id, int *slot) {
+    *id = -1;
+    for (int i = 0; i < CLIENT_MAX_WINDOWS && *id < 0; i++)
+        if (!client_window(c, i)) *id = i;
+    *slot = *id >= 0 ? window_alloc() : -1;
+    return *slot >= 0;
+}
+
+static void push_configure(int slot);
+
+void clients_init(client_array_t *clients) {
+    clients->items = NULL;
+    clients->size = 0;
+    clients->capacity = 0;
+    configure_hook = push_configure;
+}
+
+void clients_free(client_array_t *clients) {
+    while (clients->size) clients_remove(clients, clients->items[clients->size - 1]);
+    free(clients->items);
+    clients->items = NULL;
+    clients->capacity = 0;
+}
+
+// the fd is the caller's until this succeeds, then it's closed with the client
+client_t *clients_add(client_array_t *clients, int fd) {
+    if (clients->size == clients->capacity) {
+        size_t new_capacity = clients->capacity ? clients->capacity * 2 : 4;
+        client_t **new_items = realloc(clients->items, new_capacity * sizeof(*new_items));
+        if (!new_items) return NULL;
+        clients->items = new_items;
+        clients->capacity = new_capacity;
+    }
+
+    int flags = fcntl(fd, F_GETFL);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        perror("fcntl O_NONBLOCK");
+        return NULL;
+    }
+
+    client_t *c = calloc(1, sizeof(*c));
+    if (!c) return NULL;
+    c->fd = fd;
+    c->source.fd = -1;
+    c->state = CLIENT_RX_CMD;
+    c->release_buffer = -1;
+    c->index = clients->size;
+    clients->items[clients->size++] = c;
+    return c;
+}
+
+// order doesn't matter, the last client takes the removed one's slot
+void clients_remove(client_array_t *clients, client_t *c) {
+    size_t index = c->index;
+    if (index >= clients->size || clients->items[index] != c) return;
+    loop_remove(&c->source);
+    // only this client's windows go away
+    for (int id = 0; id < CLIENT_MAX_WINDOWS; id++) {
+        window_t *win = client_window(c, id);
+        if (win) handle_destroy(win - windows);
+    }
+    close(c->fd);
+    client_close_fds(c);
+    free(c);
+    if (index != --clients->size) {
+        clients->items[index] = clients->items[clients->size];
+        clients->items[index]->index = index;
+    }
+}
+
+//=======================================================================
+
+// replies are tiny and clients wait for them, so they normally go out right
+// away. whatever the socket doesn't take is kept and flushed on POLLOUT
+static bool client_send(client_t *c, const void *data, size_t len) {
+    if (!c->tx_len) {
+        ssize_t w = send(c->fd, data, len, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (w < 0 && errno != EAGAIN && errno != EINTR) return false;
+        if (w > 0) {
+            data = (const unsigned char *)data + w;
+            len -= w;
+        }
+    }
+    if (!len) return true;
+    if (c->tx_len + len > sizeof(c->tx)) {
+        fprintf(stderr, "client isn't reading its replies, dropping it\n");
+        return false;
+    }
+    memcpy(c->tx + c->tx_len, data, len);
+    c->tx_len += len;
+    return true;
+}
+
+static bool client_reply(client_t *c, int window, const void *data, size_t len) {
+    unsigned char msg[sizeof(sqws_msg_header_t) + sizeof(sqws_window_info_t)];
+    sqws_msg_header_t hdr = { SQWS_MSG_REPLY, window, len };
+    memcpy(msg, &hdr, sizeof(hdr));
+    if (len) memcpy(msg + sizeof(hdr), data, len);
+    return client_send(c, msg, sizeof(hdr) + len);
+}
+
+// events for a window go to its owner. a client that hasn't read anything for
+// so long that its socket and queue are full can't take more: motion is
+// dropped, as the next one tells where the pointer is, and a configure waits
+// for the queue to drain. a lost key or button would leave it wrong about
+// what is held down, so it is disconnected instead. false if it didn't fit
+static bool push_msg(int slot, int type, const void *payload, size_t size) {
+    client_t *c = windows[slot].owner;
+    if (!c) return true;
+    unsigned char msg[sizeof(sqws_msg_header_t) + 32];
+    sqws_msg_header_t hdr = { type, windows[slot].id, size };
+    memcpy(msg, &hdr, sizeof(hdr));
+    memcpy(msg + sizeof(hdr), payload, size);
+    if (c->tx_len + sizeof(hdr) + size > sizeof(c->tx)) return false;
+    // can't fail, whatever the socket doesn't take fits in tx
+    client_send(c, msg, sizeof(hdr) + size);
+    // woken up for EPOLLOUT once the loop sees tx_len
+    if (c->tx_len) loop_modify(&c->source, EPOLLIN | EPOLLOUT);
+    return true;
+}
+
+void clients_push_input(int type, int slot, const sqws_input_t *in) {
+    if (push_msg(slot, type, in, sizeof(*in)) || type == SQWS_MSG_MOTION) return;
+    client_t *c = windows[slot].owner;
+    if (c->overflowed) return;
+    fprintf(stderr, "client isn't reading its input, dropping it\n");
+    c->overflowed = true;
+    loop_defer(&c->source);
+}
+
+// the last configure of windows[slot], with the state it has now
+static void push_configure(int slot) {
+    window_t *w = &windows[slot];
+    sqws_configure_t cfg = {
+        .serial = w->configure_serial, .w = w->configure_w, .h = w->configure_h,
+        .state = (w->maximized ? SQWS_STATE_MAXIMIZED : 0) | (w->fullscreen ? SQWS_STATE_FULLSCREEN : 0),
+    };
+    w->configure_unsent = !push_msg(slot, SQWS_MSG_CONFIGURE, &cfg, sizeof(cfg));
+    if (w->configure_unsent) w->owner->configure_unsent = true;
+}
+
+void clients_frame_done(client_array_t *clients) {
+    for (size_t i = 0; i < clients->size;) {
+        client_t *c = clients->items[i];
+        if (c->release_buffer < 0 || frames_done() < c->release_frame) {
+            i++;
+            continue;
+        }
+        unsigned char released = c->release_buffer;
+        c->release_buffer = -1;
+        // what came in meanwhile is parsed on the next round
+        c->pending = true;
+        if (!client_reply(c, c->release_id, &released, 1) ||
+            !loop_modify(&c->source, EPOLLIN | (c->tx_len ? EPOLLOUT : 0)) || !loop_defer(&c->source)) {
+            printf("client disconnected, closing its windows\n");
+            // the last client takes its place
+            clients_remove(clients, c);
+            continue;
+        }
+        i++;
+    }
+}
+
+bool client_flush(client_t *c) {
+    while (c->tx_len) {
+        ssize_t w = send(c->fd, c->tx, c->tx_len, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN) return false;
+            break;
+        }
+        memmove(c->tx, c->tx + w, c->tx_len - w);
+        c->tx_len -= w;
+    }
+    // configures that didn't fit before, as they are now
+    if (c->configure_unsent) {
+        c->configure_unsent = false;
+        for (int id = 0; id < CLIENT_MAX_WINDOWS; id++) {
+            window_t *w = client_window(c, id);
+            if (w && w->configure_unsent) push_configure(w - windows);
+        }
+    }
+    return true;
+}
+
+// fds passed with SCM_RIGHTS are queued until the command that uses them
+static ssize_t client_recv(client_t *c, void *buf, size_t len) {
+    char ctrl[CMSG_SPACE(sizeof(int) * CLIENT_MAX_FDS)];
+    struct iovec iov = { .iov_base = buf, .iov_len = len };
+    struct msghdr msg = {
+        .msg_iov = &iov,
+        .msg_iovlen = 1,
+        .msg_control = ctrl,
+        .msg_controllen = sizeof(ctrl),
+    };
+
+    ssize_t r = recvmsg(c->fd, &msg, MSG_CMSG_CLOEXEC | MSG_DONTWAIT);
+    if (r < 0) return r;
+
+    for (struct cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+        if (cm->cmsg_level != SOL_SOCKET || cm->cmsg_type != SCM_RIGHTS) continue;
+        int n = (cm->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (int i = 0; i < n; i++) {
+            int fd;
+            memcpy(&fd, CMSG_DATA(cm) + i * sizeof(int), sizeof(int));
+            if (c->nfds < CLIENT_MAX_FDS) c->passed_fds[c->nfds++] = fd;
+            else close(fd);
+        }
+    }
+    return r;
+}
+
+static int client_take_fd(client_t *c) {
+    if (!c->nfds) return -1;
+    int fd = c->passed_fds[0];
+    memmove(c->passed_fds, c->passed_fds + 1, --c->nfds * sizeof(int));
+    return fd;
+}
+
+//=======================================================================
+
+// how much of a command is parsed from the buffer, header included. pixel
+// payloads and the payloads of unknown commands are streamed instead. 0 if
+// the header is malformed
+static size_t cmd_size(const sqws_cmd_header_t *hdr) {
+    size_t h = sizeof(*hdr);
+    if (hdr->size % 4) return 0;
+    switch (hdr->opcode) {
+        case SQWS_CMD_CREATE_WINDOW: return hdr->size == sizeof(sqws_create_t) ? h + hdr->size : 0;
+        case SQWS_CMD_MOVE_WINDOW:
+        case SQWS_CMD_ATTACH_SHM: return hdr->size == 2 * sizeof(int32_t) ? h + hdr->size : 0;
+        case SQWS_CMD_ACK_CONFIGURE: return hdr->size == sizeof(uint32_t) ? h + hdr->size : 0;
+        case SQWS_CMD_DRAW_RECTS:
+            return hdr->arg <= SQWS_MAX_RECTS && hdr->size >= hdr->arg * 16u ? h + hdr->arg * 16u : 0;
+        case SQWS_CMD_DESTROY_WINDOW:
+        case SQWS_CMD_COMMIT_SHM:
+        case SQWS_CMD_SET_SURFACE:
+        case SQWS_CMD_SET_FULLSCREEN:
+        case SQWS_CMD_WINDOW_INFO: return hdr->size == 0 ? h : 0;
+        default: return h;
+    }
+}
+
+// a client may put a window anywhere from which it can still reach the
+// output, no further: x + w and the like then stay far from overflowing
+static int32_t clamp_position(int32_t v, int screen) {
+    int32_t reach = SQWS_MAX_CANVAS + screen;
+    return v < -reach ? -reach : v > reach ? reach : v;
+}
+
+// starts receiving the pixels of px_count rects into the canvas of win,
+// NULL to drop them
+static void begin_pixels(client_t *c, const window_t *win, bool whole) {
+    c->state = CLIENT_RX_PIXELS;
+    c->px_window = win ? win - windows : -1;
+    c->px_gen = win ? win->gen : 0;
+    c->px_whole = whole;
+    c->px_next = false;
+    c->px_rect = 0;
+    c->px_row = 0;
+    c->px_offset = 0;
+}
+
+// a payload that is of no use is dropped like the pixels of one long row
+static void skip_payload(client_t *c, uint32_t size) {
+    if (!size) return;
+    c->px_count = 1;
+    c->px_rects[0][0] = c->px_rects[0][1] = 0;
+    c->px_rects[0][2] = size / 4;
+    c->px_rects[0][3] = 1;
+    begin_pixels(c, NULL, false);
+}
+
+// what a client gets to know about one of its windows, none of the server's
+// own state
+static bool reply_info(client_t *c, int idx, const window_t *w) {
+    sqws_window_info_t info = {
+        .x = w->x, .y = w->y, .w = w->w, .h = w->h,
+        .canvas_w = w->canvas_w, .canvas_h = w->canvas_h,
+        .flags = (w->focused ? SQWS_WINDOW_FOCUSED : 0) | (w->minimized ? SQWS_WINDOW_MINIMIZED : 0) |
+                 (w->maximized ? SQWS_WINDOW_MAXIMIZED : 0) | (w->fullscreen ? SQWS_WINDOW_FULLSCREEN : 0),
+        .surface_mode = w->surface_mode,
+    };
+    memcpy(info.color, w->color, sizeof(info.color));
+    memcpy(info.title, w->title, sizeof(info.title));
+    return client_reply(c, idx, &info, sizeof(info));
+}
+
+static bool handle_cmd(client_t *c, const sqws_cmd_header_t *hdr, const unsigned char *payload) {
+    int idx = hdr->window;
+    window_t *win = client_window(c, idx);
+
+    switch (hdr->opcode) {
+        case SQWS_CMD_CREATE_WINDOW: {
+            // the reply carries the new window's id and info
+            sqws_create_t cr;
+            char title[sizeof(cr.title) + 1];
+            int slot;
+            memcpy(&cr, payload, sizeof(cr));
+            memcpy(title, cr.title, sizeof(cr.title));
+            title[sizeof(cr.title)] = '\0';
+            if (cr.w > SQWS_MAX_CANVAS || cr.h > SQWS_MAX_CANVAS) {
+                fprintf(stderr, "window of %dx%d is too big\n", cr.w, cr.h);
+                return client_reply(c, 0, NULL, 0);
+            }
+            if (!client_new_window(c, &idx, &slot)) {
+                fprintf(stderr, "out of windows\n");
+                return client_reply(c, 0, NULL, 0);
+            }
+            cr.x = clamp_position(cr.x, mode.hdisplay);
+            cr.y = clamp_position(cr.y, mode.vdisplay);
+            handle_create(slot, title, cr.x, cr.y, cr.w, cr.h, cr.color);
+            win = &windows[slot];
+            win->owner = c;
+            win->id = idx;
+            c->win_slot[idx] = slot + 1;
+            c->win_gen[idx] = win->gen;
+            return reply_info(c, idx, win);
+        }
+        case SQWS_CMD_DESTROY_WINDOW:
+            if (win) handle_destroy(win - windows);
+            c->win_slot[idx] = 0;
+            return true;
+        case SQWS_CMD_MOVE_WINDOW: {
+            int32_t pos[2];
+            memcpy(pos, payload, sizeof(pos));
+            if (win) handle_move(win, clamp_position(pos[0], mode.hdisplay), clamp_position(pos[1], mode.vdisplay));
+            return true;
+        }
+        case SQWS_CMD_DRAW_WINDOW:
+            c->px_count = 1;
+            c->px_rects[0][0] = 0;
+            c->px_rects[0][1] = 0;
+            // at the size the client acked, it takes the place of the canvas
+            // once it is all in. a shared canvas attached for that size
+            // before is dropped, the upload is what is to be shown
+            if (win && win->configure_acked && hdr->size == (uint64_t)win->configure_w * win->configure_h * 4) {
+                if (win->next_shm_map) window_drop_next(win);
+                if (window_stage_canvas(win)) {
+                    c->px_rects[0][2] = win->configure_w;
+                    c->px_rects[0][3] = win->configure_h;
+                    begin_pixels(c, win, true);
+                    c->px_next = true;
+                    return true;
+                }
+            }
+            // otherwise it's dropped unless it is as big as the canvas is
+            // now: the window may be gone, resized or shared since
+            if (!win || win->configure_acked || !win->canvas || win->shm_map ||
+                hdr->size != (uint64_t)win->canvas_w * win->canvas_h * 4) {
+                skip_payload(c, hdr->size);
+                return true;
+            }
+            c->px_rects[0][2] = win->canvas_w;
+            c->px_rects[0][3] = win->canvas_h;
+            begin_pixels(c, win, true);
+            return true;
+        case SQWS_CMD_DRAW_RECTS: {
+            int count = hdr->arg;
+            uint64_t total = count * 16u;
+            memcpy(c->px_rects, payload, count * 16u);
+            // no rect is bigger than the canvas it goes to, or than the payload
+            // when there is none to go to
+            window_t *target = win && !win->configure_acked && win->canvas && !win->shm_map ? win : NULL;
+            for (int i = 0; i < count; i++) {
+                int w = c->px_rects[i][2], h = c->px_rects[i][3];
+                if (w <= 0 || h <= 0 || (uint64_t)w * h * 4 > hdr->size) return false;
+                if (target && (w > target->canvas_w || h > target->canvas_h)) return false;
+                total += (uint64_t)w * h * 4;
+            }
+            if (total != hdr->size) return false;
+            c->px_count = count;
+            // after an ack only a whole canvas of the new size will do
+            if (count) begin_pixels(c, win && !win->configure_acked ? win : NULL, false);
+            return true;
+        }
+        case SQWS_CMD_ATTACH_SHM: {
+            unsigned char status = 0;
+            int32_t size[2];
+            memcpy(size, payload, sizeof(size));
+            int fd = client_take_fd(c);
+            if (win && fd >= 0)
+                status = shm_attach(win, fd, size[0], size[1]);
+            if (fd >= 0) close(fd);
+            return client_reply(c, idx, &status, 1);
+        }
+        case SQWS_CMD_COMMIT_SHM: {
+            unsigned char released = 0xFF;
+            if (win) {
+                // in the frame on screen or in the one about to be
+                bool scanned_out = win->scanout_frame && win->scanout_frame >= frames_done();
+                int b = shm_commit(win, hdr->arg);
+                if (b >= 0 && scanned_out) {
+                    // free once a frame presented after this commit is shown
+                    c->release_buffer = b;
+                    c->release_id = idx;
+                    c->release_frame = frames_presented() + 1;
+                    return true;
+                }
+                if (b >= 0) released = b;
+            }
+            return client_reply(c, idx, &released, 1);
+        }
+        case SQWS_CMD_ACK_CONFIGURE: {
+            uint32_t serial;
+            memcpy(&serial, payload, sizeof(serial));
+            if (win && serial == win->configure_serial) {
+                window_drop_next(win);
+                win->configure_acked = true;
+            }
+            return true;
+        }
+        case SQWS_CMD_SET_SURFACE:
+            if (win && hdr->arg <= SQWS_SURFACE_BLEND) {
+                win->surface_mode = hdr->arg;
+                window_update_geom(win);
+                damage_window(win);
+            }
+            return true;
+        case SQWS_CMD_SET_FULLSCREEN:
+            if (win) window_set_fullscreen(win, hdr->arg != 0);
+            return true;
+        case SQWS_CMD_WINDOW_INFO:
+            if (win) return reply_info(c, idx, win);
+            return client_reply(c, idx, NULL, 0);
+        default:
+            skip_payload(c, hdr->size);
+            return true;
+    }
+}
+
+// the window pixels go to, looked up again every time since it may have been
+// destroyed, resized or switched to a shared canvas since the header came in
+static window_t *pixels_window(const client_t *c) {
+    if (c->px_window < 0) return NULL;
+    window_t *win = &windows[c->px_window];
+    if (!win->used || win->gen != c->px_gen) return NULL;
+    if (c->px_next) return win->next_canvas ? win : NULL;
+    return win->canvas && !win->shm_map ? win : NULL;
+}
+
+// where the next pixel bytes go and how many can go there in one piece: the
+// rest of the row, or of the whole rect when its rows follow each other in
+// the canvas. *dst is NULL when they are to be dropped
+static size_t pixels_dst(client_t *c, unsigned char **dst) {
+    const int32_t *r = c->px_rects[c->px_rect];
+    size_t row = (size_t)r[2] * 4;
+    size_t rest = (size_t)(r[3] - c->px_row) * row - c->px_offset;
+    window_t *win = pixels_window(c);
+    unsigned char *canvas = !win ? NULL : c->px_next ? win->next_canvas : win->canvas;
+    int cw = !win ? 0 : c->px_next ? win->configure_w : win->canvas_w;
+    int ch = !win ? 0 : c->px_next ? win->configure_h : win->canvas_h;
+    // the client picks the rect, so no sums that could overflow
+    if (!win || r[0] < 0 || r[1] < 0 || r[2] > cw - r[0] || r[3] > ch - r[1]) {
+        *dst = NULL;
+        return rest;
+    }
+    *dst = canvas + ((size_t)(r[1] + c->px_row) * cw + r[0]) * 4 + c->px_offset;
+    if (!c->px_next) win->drawn = true;
+    return r[2] == cw ? rest : row - c->px_offset;
+}
+
+// accounts for n bytes received into or dropped from the current rect
+static void pixels_advance(client_t *c, size_t n) {
+    const int32_t *r = c->px_rects[c->px_rect];
+    size_t row = (size_t)r[2] * 4;
+    c->px_offset += n;
+    if (c->px_offset < row) return;
+
+    c->px_row += c->px_offset / row;
+    c->px_offset %= row;
+    if (c->px_row < r[3]) return;
+
+    window_t *win = pixels_window(c);
+    if (win && c->px_next) window_adopt_next(win);
+    else if (win && c->px_whole) damage_window(win);
+    else if (win) damage_canvas(win, r[0], r[1], r[2], r[3]);
+    c->px_row = 0;
+    if (++c->px_rect == c->px_count) c->state = CLIENT_RX_CMD;
+}
+
+// handles what is in the receive buffer, returns false if the client sent
+// something that can't be parsed
+static bool client_parse(client_t *c, int *cmds) {
+    size_t pos = 0;
+    bool ok = true;
+    while (pos < c->rx_len && *cmds > 0 && c->release_buffer < 0) {
+        if (c->state == CLIENT_RX_PIXELS) {
+            unsigned char *dst;
+            size_t n = pixels_dst(c, &dst);
+            if (n > c->rx_len - pos) n = c->rx_len - pos;
+            if (dst) memcpy(dst, c->rx + pos, n);
+            pos += n;
+            pixels_advance(c, n);
+            continue;
+        }
+
+        sqws_cmd_header_t hdr;
+        if (c->rx_len - pos < sizeof(hdr)) break;
+        memcpy(&hdr, c->rx + pos, sizeof(hdr));
+        size_t size = cmd_size(&hdr);
+        if (!size) {
+            fprintf(stderr, "malformed command 0x%02x from client\n", hdr.opcode);
+            ok = false;
+            break;
+        }
+        if (size > c->rx_len - pos) break;
+        if (!handle_cmd(c, &hdr, c->rx + pos + sizeof(hdr))) {
+            ok = false;
+            break;
+        }
+        pos += size;
+        (*cmds)--;
+    }
+    memmove(c->rx, c->rx + pos, c->rx_len - pos);
+    c->rx_len -= pos;
+    return ok;
+}
+
+bool client_read(client_t *c) {
+    size_t budget = CLIENT_READ_BUDGET;
+    int cmds = CLIENT_CMD_BUDGET;
+    c->pending = false;
+
+    for (;;) {
+        if (!client_parse(c, &cmds)) return false;
+        // the rest waits for the held back commit reply
+        if (c->release_buffer >= 0) return true;
+        if (!cmds || !budget) {
+            c->pending = true;
+            return true;
+        }
+
+        ssize_t r;
+        unsigned char *dst = NULL;
+        size_t want = 0;
+        if (c->state == CLIENT_RX_PIXELS && !c->rx_len) want = pixels_dst(c, &dst);
+        // small pieces go through the buffer, a read per row of a small
+        // rect costs more than the copy
+        if (dst && want >= DIRECT_RECV_MIN) {
+            // straight into the canvas, the rest of this row at most
+            if (want > budget) want = budget;
+            r = client_recv(c, dst, want);
+            if (r > 0) pixels_advance(c, r);
+        } else {
+            want = sizeof(c->rx) - c->rx_len;
+            if (want > budget) want = budget;
+            if (!want) {
+                c->pending = true;
+                return true;
+            }
+            r = client_recv(c, c->rx + c->rx_len, want);
+            if (r > 0) c->rx_len += r;
+        }
+
+        if (r == 0) return false;
+        if (r < 0) {
+            if (errno == EINTR) continue;
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        budget -= r;
+    }
+}
+
+_Static_assert(sizeof(((client_t *)0)->rx) >= MAX_CMD_SIZE, "receive buffer must hold any command");
@@ -0,0 +1,219 @@
+#include "wm.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// the damaged part of the screen is cut along a grid of tiles and the tiles
+// are handed out to a fixed pool of threads, the calling thread included. the
+// caller doesn't touch windows[] until every tile is done, so for the workers
+// the window list is a read-only snapshot. configured through
+//   SQWS_THREADS  composing threads, default one per online CPU
+//   SQWS_TILE     tile size as WxH, or N for square tiles, default 1024x64
+//
+// tiles are wide and short on purpose: a tile's rows are separate runs of
+// memory, and runs of a few hundred bytes are several times slower to clear
+// and copy than long ones
+
+#define MAX_THREADS 64
+#define DEFAULT_TILE_W 1024
+#define DEFAULT_TILE_H 64
+
+static int nthreads = 1;
+static int tile_w = DEFAULT_TILE_W, tile_h = DEFAULT_TILE_H;
+
+static pthread_t threads[MAX_THREADS];
+static compose_ctx_t ctxs[MAX_THREADS];
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static unsigned generation = 0;
+static int busy = 0;
+static bool quit = false;
+
+// the current job
+static unsigned char *job_buf;
+static int job_pitch;
+static rect_t *tiles = NULL;
+static int tile_count = 0, tile_cap = 0;
+static atomic_int next_tile;
+
+static region_t piece;
+
+static void run_tiles(compose_ctx_t *ctx) {
+    int i;
+    while ((i = atomic_fetch_add(&next_tile, 1)) < tile_count)
+        compose_rect(ctx, job_buf, job_pitch, &tiles[i]);
+}
+
+static void *worker(void *arg) {
+    compose_ctx_t *ctx = arg;
+    unsigned seen = 0;
+
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        while (generation == seen && !quit) pthread_cond_wait(&work_cond, &lock);
+        if (quit) break;
+        seen = generation;
+        pthread_mutex_unlock(&lock);
+
+        run_tiles(ctx);
+
+        pthread_mutex_lock(&lock);
+        if (--busy == 0) pthread_cond_signal(&done_cond);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+bool compose_init(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    nthreads = cpus > 0 ? cpus : 1;
+    const char *env = getenv("SQWS_THREADS");
+    if (env) nthreads = atoi(env);
+    if (nthreads < 1) nthreads = 1;
+    if (nthreads > MAX_THREADS) nthreads = MAX_THREADS;
+
+    env = getenv("SQWS_TILE");
+    if (env) {
+        int n = sscanf(env, "%dx%d", &tile_w, &tile_h);
+        if (n == 1) tile_h = tile_w;
+        if (n < 1) fprintf(stderr, "bad SQWS_TILE %s, want WxH\n", env);
+    }
+    if (tile_w < 16) tile_w = 16;
+    if (tile_h < 16) tile_h = 16;
+
+    // signals are for the main thread
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+    for (int i = 1; i < nthreads; i++) {
+        if (pthread_create(&threads[i], NULL, worker, &ctxs[i]) != 0) {
+            fprintf(stderr, "only %d of %d compose threads started\n", i, nthreads);
+            nthreads = i;
+            break;
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    return true;
+}
+
+void compose_cleanup(void) {
+    pthread_mutex_lock(&lock);
+    quit = true;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&lock);
+    for (int i = 1; i < nthreads; i++) pthread_join(threads[i], NULL);
+    for (int i = 0; i < nthreads; i++) compose_ctx_free(&ctxs[i]);
+    nthreads = 1;
+    quit = false;
+
+    free(tiles);
+    tiles = NULL;
+    tile_count = tile_cap = 0;
+    region_free(&piece);
+}
+
+int compose_threads(void) {
+    return nthreads;
+}
+
+static bool add_tile(const rect_t *r) {
+    if (tile_count == tile_cap) {
+        int cap = tile_cap ? tile_cap * 2 : 64;
+        rect_t *t = realloc(tiles, cap * sizeof(*t));
+        if (!t) return false;
+        tiles = t;
+        tile_cap = cap;
+    }
+    tiles[tile_count++] = *r;
+    return true;
+}
+
+// cuts r along the tile grid. the grid is fixed to the screen, so a tile of
+// one rect never straddles the grid line of another
+static bool add_tiles(const rect_t *r) {
+    for (int ty = r->y0 - r->y0 % tile_h; ty < r->y1; ty += tile_h) {
+        for (int tx = r->x0 - r->x0 % tile_w; tx < r->x1; tx += tile_w) {
+            rect_t t = {
+                tx > r->x0 ? tx : r->x0, ty > r->y0 ? ty : r->y0,
+                tx + tile_w < r->x1 ? tx + tile_w : r->x1,
+                ty + tile_h < r->y1 ? ty + tile_h : r->y1,
+            };
+            if (!add_tile(&t)) return false;
+        }
+    }
+    return true;
+}
+
+static void compose_rects(unsigned char *buf, int pitch, const rect_t *rects, int count, int sw, int sh) {
+    window_prepare_decorations();
+
+    // damage rects may overlap, and two threads must never compose the same
+    // pixel since blending reads what is already there. make them disjoint
+    // first, then cut them into tiles
+    long area = 0;
+    tile_count = 0;
+    for (int i = 0; i < count; i++) {
+        rect_t r = rects[i];
+        if (r.x0 < 0) r.x0 = 0;
+        if (r.y0 < 0) r.y0 = 0;
+        if (r.x1 > sw) r.x1 = sw;
+        if (r.y1 > sh) r.y1 = sh;
+        if (!region_set(&piece, &r)) goto serial;
+        for (int k = 0; k < i && piece.count; k++)
+            if (!region_subtract(&piece, &rects[k])) goto serial;
+        for (int k = 0; k < piece.count; k++) {
+            const rect_t *p = &piece.rects[k];
+            area += (long)(p->x1 - p->x0) * (p->y1 - p->y0);
+            if (!add_tiles(p)) goto serial;
+        }
+    }
+    if (!tile_count) return;
+
+    job_buf = buf;
+    job_pitch = pitch;
+    atomic_store(&next_tile, 0);
+
+    // not worth waking anyone for a cursor sized update
+    if (nthreads == 1 || tile_count == 1 || area < (long)tile_w * tile_h) {
+        run_tiles(&ctxs[0]);
+        return;
+    }
+
+    pthread_mutex_lock(&lock);
+    busy = nthreads - 1;
+    generation++;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&lock);
+
+    run_tiles(&ctxs[0]);
+
+    pthread_mutex_lock(&lock);
+    while (busy) pthread_cond_wait(&done_cond, &lock);
+    pthread_mutex_unlock(&lock);
+    return;
+
+serial:
+    for (int i = 0; i < count; i++) {
+        rect_t r = rects[i];
+        if (r.x0 < 0) r.x0 = 0;
+        if (r.y0 < 0) r.y0 = 0;
+        if (r.x1 > sw) r.x1 = sw;
+        if (r.y1 > sh) r.y1 = sh;
+        if (r.x1 > r.x0 && r.y1 > r.y0) compose_rect(&ctxs[0], buf, pitch, &r);
+    }
+}
+
+void redraw_all(unsigned char *buf, int pitch, int sw, int sh) {
+    rect_t r = {0, 0, sw, sh};
+    compose_rects(buf, pitch, &r, 1, sw, sh);
+}
+
+void redraw_damage(unsigned char *buf, int pitch, int sw, int sh, const damage_t *damage) {
+    compose_rects(buf, pitch, damage->rects, damage->count, sw, sh);
+}
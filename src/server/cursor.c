@@ -0,0 +1,203 @@
+#include "wm.h"
+#include "draw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// the pointer is not part of the composed frame. it is drawn into the buffer
+// that gets presented, after saving the pixels it covers there. when it moves
+// those pixels are put back and it is drawn again at the new spot, so a move
+// only touches the rect it leaves and the rect it goes to, and nothing has to
+// be composed for it. a backend scanning out a client's canvas, which can't
+// be drawn into, puts the sprite on its cursor plane instead
+//
+// a backend keeps one cursor_save_t per buffer it presents, as the cursor can
+// be at a different spot in each of them. configured through
+//   SQWS_CURSOR          PAM file (TUPLTYPE RGB_ALPHA) to use as the sprite
+//   SQWS_CURSOR_HOTSPOT  X,Y of the pixel in it that points, default 0,0
+
+#define CURSOR_MAX 256
+
+static uint32_t *sprite;
+static int sprite_w, sprite_h, hot_x, hot_y;
+static uint32_t sprite_gen;
+
+// X outline, . fill, anything else is clear
+static const char *const arrow[] = {
+    "X",
+    "XX",
+    "X.X",
+    "X..X",
+    "X...X",
+    "X....X",
+    "X.....X",
+    "X......X",
+    "X.......X",
+    "X........X",
+    "X.........X",
+    "X......XXXXX",
+    "X...X..X",
+    "X..XX..X",
+    "X.X  X..X",
+    "XX   X..X",
+    "X     X..X",
+    "      X..X",
+    "       XX",
+};
+
+bool cursor_set_sprite(const uint32_t *argb, int w, int h, int hx, int hy) {
+    if (w <= 0 || h <= 0 || w > CURSOR_MAX || h > CURSOR_MAX) return false;
+    uint32_t *p = malloc((size_t)w * h * sizeof(*p));
+    if (!p) return false;
+    memcpy(p, argb, (size_t)w * h * sizeof(*p));
+    free(sprite);
+    sprite = p;
+    sprite_w = w;
+    sprite_h = h;
+    hot_x = hx;
+    hot_y = hy;
+    sprite_gen++;
+    return true;
+}
+
+static bool load_arrow(void) {
+    enum { W = 12, H = sizeof(arrow) / sizeof(arrow[0]) };
+    uint32_t px[W * H] = {0};
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; arrow[y][x]; x++) {
+            if (arrow[y][x] == 'X') px[y * W + x] = 0xff000000;
+            else if (arrow[y][x] == '.') px[y * W + x] = 0xffffffff;
+        }
+    }
+    return cursor_set_sprite(px, W, H, 0, 0);
+}
+
+static bool load_pam(const char *path, int hx, int hy) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    char line[128], tupltype[32] = "";
+    int w = 0, h = 0, depth = 0, maxval = 0;
+    bool header = fgets(line, sizeof(line), f) && !strcmp(line, "P7\n");
+    while (header && fgets(line, sizeof(line), f)) {
+        if (!strcmp(line, "ENDHDR\n")) break;
+        sscanf(line, "WIDTH %d", &w);
+        sscanf(line, "HEIGHT %d", &h);
+        sscanf(line, "DEPTH %d", &depth);
+        sscanf(line, "MAXVAL %d", &maxval);
+        sscanf(line, "TUPLTYPE %31s", tupltype);
+    }
+    if (!header || strcmp(line, "ENDHDR\n") || depth != 4 || maxval != 255 || strcmp(tupltype, "RGB_ALPHA") ||
+        w <= 0 || h <= 0 || w > CURSOR_MAX || h > CURSOR_MAX) {
+        fprintf(stderr, "%s: not an 8-bit RGB_ALPHA PAM of at most %dx%d\n", path, CURSOR_MAX, CURSOR_MAX);
+        fclose(f);
+        return false;
+    }
+    uint32_t *px = malloc((size_t)w * h * sizeof(*px));
+    bool ok = px && fread(px, 4, (size_t)w * h, f) == (size_t)w * h;
+    fclose(f);
+    if (!ok) {
+        fprintf(stderr, "%s: truncated\n", path);
+        free(px);
+        return false;
+    }
+    // RGBA bytes to the BGRA the screen uses
+    for (int i = 0; i < w * h; i++) {
+        const unsigned char *c = (const unsigned char *)&px[i];
+        px[i] = (uint32_t)c[3] << 24 | (uint32_t)c[0] << 16 | (uint32_t)c[1] << 8 | c[2];
+    }
+    ok = cursor_set_sprite(px, w, h, hx, hy);
+    free(px);
+    return ok;
+}
+
+bool cursor_init(void) {
+    const char *path = getenv("SQWS_CURSOR");
+    if (path) {
+        int hx = 0, hy = 0;
+        const char *hot = getenv("SQWS_CURSOR_HOTSPOT");
+        if (hot && sscanf(hot, "%d,%d", &hx, &hy) != 2)
+            fprintf(stderr, "bad SQWS_CURSOR_HOTSPOT %s, want X,Y\n", hot);
+        if (load_pam(path, hx, hy)) return true;
+        fprintf(stderr, "falling back to the built-in cursor\n");
+    }
+    return load_arrow();
+}
+
+void cursor_cleanup(void) {
+    free(sprite);
+    sprite = NULL;
+}
+
+void cursor_save_free(cursor_save_t *s) {
+    free(s->under);
+    memset(s, 0, sizeof(*s));
+}
+
+static bool overlaps(const rect_t *a, const rect_t *b) {
+    return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+void cursor_erase(cursor_save_t *s, unsigned char *buf, int pitch, const damage_t *repaint, damage_t *touched) {
+    if (!s->shown) return;
+    bool stays = s->gen == sprite_gen && s->x == mouse_x && s->y == mouse_y;
+    for (int i = 0; stays && i < repaint->count; i++)
+        if (overlaps(&repaint->rects[i], &s->rect)) stays = false;
+    if (stays) return;
+
+    const rect_t *r = &s->rect;
+    size_t row = (size_t)(r->x1 - r->x0) * 4;
+    for (int y = r->y0; y < r->y1; y++)
+        memcpy(buf + (size_t)y * pitch + r->x0 * 4, (unsigned char *)s->under + (y - r->y0) * row, row);
+    if (touched) damage_add_rect(touched, r);
+    s->shown = false;
+}
+
+// without a mouse there's no pointer to show
+bool cursor_shown(void) {
+    return sprite && mouse_fd >= 0;
+}
+
+const uint32_t *cursor_sprite(int *w, int *h, int *hx, int *hy, uint32_t *gen) {
+    if (!cursor_shown()) return NULL;
+    *w = sprite_w;
+    *h = sprite_h;
+    *hx = hot_x;
+    *hy = hot_y;
+    *gen = sprite_gen;
+    return sprite;
+}
+
+void cursor_draw(cursor_save_t *s, unsigned char *buf, int pitch, damage_t *touched) {
+    if (s->shown || !cursor_shown()) return;
+
+    int x = mouse_x - hot_x, y = mouse_y - hot_y;
+    rect_t r = { x < 0 ? 0 : x, y < 0 ? 0 : y, x + sprite_w, y + sprite_h };
+    if (r.x1 > mode.hdisplay) r.x1 = mode.hdisplay;
+    if (r.y1 > mode.vdisplay) r.y1 = mode.vdisplay;
+    if (r.x0 >= r.x1 || r.y0 >= r.y1) return;
+
+    size_t need = (size_t)sprite_w * sprite_h;
+    if (need > s->under_cap) {
+        uint32_t *under = realloc(s->under, need * sizeof(*under));
+        if (!under) return;
+        s->under = under;
+        s->under_cap = need;
+    }
+    size_t row = (size_t)(r.x1 - r.x0) * 4;
+    for (int py = r.y0; py < r.y1; py++)
+        memcpy((unsigned char *)s->under + (py - r.y0) * row, buf + (size_t)py * pitch + r.x0 * 4, row);
+    const uint32_t *src = sprite + (size_t)(r.y0 - y) * sprite_w + (r.x0 - x);
+    blit_rect(buf + (size_t)r.y0 * pitch + r.x0 * 4, pitch, (const unsigned char *)src, sprite_w * 4,
+              r.x1 - r.x0, r.y1 - r.y0, SQWS_SURFACE_BLEND);
+
+    s->shown = true;
+    s->rect = r;
+    s->x = mouse_x;
+    s->y = mouse_y;
+    s->gen = sprite_gen;
+    if (touched) damage_add_rect(touched, &r);
+}
@@ -0,0 +1,81 @@
+#include "wm.h"
+
+#include <string.h>
+
+damage_t screen_damage;
+
+static inline long rect_area(const rect_t *r) {
+    return (long)(r->x1 - r->x0) * (r->y1 - r->y0);
+}
+
+static inline rect_t rect_union(const rect_t *a, const rect_t *b) {
+    rect_t u = {
+        a->x0 < b->x0 ? a->x0 : b->x0,
+        a->y0 < b->y0 ? a->y0 : b->y0,
+        a->x1 > b->x1 ? a->x1 : b->x1,
+        a->y1 > b->y1 ? a->y1 : b->y1,
+    };
+    return u;
+}
+
+static inline bool rect_contains(const rect_t *outer, const rect_t *inner) {
+    return inner->x0 >= outer->x0 && inner->y0 >= outer->y0 &&
+           inner->x1 <= outer->x1 && inner->y1 <= outer->y1;
+}
+
+void damage_add_rect(damage_t *d, const rect_t *in) {
+    // clip to the screen, everything outside is never composed
+    rect_t r = *in;
+    if (r.x0 < 0) r.x0 = 0;
+    if (r.y0 < 0) r.y0 = 0;
+    if (r.x1 > (int)mode.hdisplay) r.x1 = mode.hdisplay;
+    if (r.y1 > (int)mode.vdisplay) r.y1 = mode.vdisplay;
+    if (r.x1 <= r.x0 || r.y1 <= r.y0) return;
+
+    for (int i = 0; i < d->count; ) {
+        if (rect_contains(&d->rects[i], &r)) return;
+
+        // swallow rects covered by the new one, and merge neighbours
+        // whose union doesn't cost more than drawing both separately
+        rect_t u = rect_union(&d->rects[i], &r);
+        if (rect_area(&u) <= rect_area(&d->rects[i]) + rect_area(&r)) {
+            r = u;
+            d->rects[i] = d->rects[--d->count];
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+
+    if (d->count < MAX_DAMAGE_RECTS) {
+        d->rects[d->count++] = r;
+        return;
+    }
+
+    // list is full: grow the rect that gets the smallest extra area
+    int best = 0;
+    long best_cost = -1;
+    for (int i = 0; i < d->count; i++) {
+        rect_t u = rect_union(&d->rects[i], &r);
+        long cost = rect_area(&u) - rect_area(&d->rects[i]);
+        if (best_cost < 0 || cost < best_cost) {
+            best = i;
+            best_cost = cost;
+        }
+    }
+    d->rects[best] = rect_union(&d->rects[best], &r);
+}
+
+void damage_add(damage_t *d, int x, int y, int w, int h) {
+    rect_t r = {x, y, x + w, y + h};
+    damage_add_rect(d, &r);
+}
+
+void damage_clear(damage_t *d) {
+    d->count = 0;
+}
+
+void damage_all(void) {
+    damage_clear(&screen_damage);
+    damage_add(&screen_damage, 0, 0, mode.hdisplay, mode.vdisplay);
+}
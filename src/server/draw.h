@@ -0,0 +1,56 @@
+#ifndef DRAW_H
+#define DRAW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "wm.h"
+
+// software rasterizer used by the compositor. buffers are 32bpp, pitch is in
+// bytes and everything is clipped to sw x sh
+
+static inline void put_pixel(unsigned char *buf, int x, int y, const unsigned char *color, int pitch, int sw, int sh) {
+    uint32_t mask = (unsigned)(x | (sw - 1 - x) | y | (sh - 1 - y)) >> 31;
+    if (!mask) {
+        *(uint32_t *)(buf + y * pitch + x * 4) = *(const uint32_t *)color;
+    }
+}
+
+static inline void blend_pixel(unsigned char *dst, const unsigned char *src) {
+    unsigned a = src[3];
+    if (a == 255) {
+        *(uint32_t *)dst = *(const uint32_t *)src;
+    } else if (a) {
+        for (int i = 0; i < 3; i++)
+            dst[i] = (src[i] * a + dst[i] * (255 - a)) / 255;
+        dst[3] = 255;
+    }
+}
+
+static inline void fill_span(uint32_t *dst, int n, uint32_t color) {
+    for (int i = 0; i < n; i++) dst[i] = color;
+}
+
+// span kernels, picked for the running CPU by blend_init()
+void blend_init(void);
+const char *blend_kernel_name(void);
+extern void (*blend_span_solid)(uint32_t *dst, int n, const unsigned char *color);
+extern void (*blend_span_argb)(uint32_t *dst, const uint32_t *src, int n);
+extern void (*blit_span_alpha_test)(uint32_t *dst, const uint32_t *src, int n);
+
+// copies a w x h block of pixels the way surface_mode (SQWS_SURFACE_*) says
+void blit_rect(unsigned char *dst, int dst_pitch, const unsigned char *src, int src_pitch,
+               int w, int h, int surface_mode);
+
+// text is UTF-8, glyphs come from the font loaded by font_init()
+void draw_char(unsigned char *buf, int x, int y, uint32_t cp, const unsigned char *color, int pitch, int sw, int sh);
+void draw_text(unsigned char *buf, int x, int y, const char *text, const unsigned char *color, int pitch, int sw, int sh);
+int text_width(const char *text);
+void draw_rect(unsigned char *buf, int x, int y, int w, int h,
+               const unsigned char *color, bool alpha, int pitch, int sw, int sh);
+void draw_button(unsigned char *buf, int x, int y, int w, int h, const unsigned char *color, const char *label, int pitch, int sw, int sh);
+
+// buf points at screen pixel (ox, oy) and is a sw x sh view of the screen
+void draw_window(const window_t *w, unsigned char *buf, int ox, int oy, int pitch, int sw, int sh);
+
+#endif // DRAW_H
@@ -1,17 +1,63 @@
 #include "wm.h"
 #include <fcntl.h>
 #include <stdio.h>
-#include <sys/poll.h>
+#include <sys/epoll.h>
 #include <unistd.h>
 #include <linux/keyboard.h>
 #include <linux/input.h>
 #include <dirent.h>
+#include <errno.h>
 #include <glob.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
 
 int mouse_fd = -1, mouse_x = 0, mouse_y = 0;
 bool mouse_left = false;
 
-bool keys_pressed[MAX_VK_CODE];
+// where the cursor goes on the next frame
+static int motion_x = 0, motion_y = 0;
+
+// SQWS_BUTTON_* held down
+static unsigned mouse_buttons = 0;
+
+// when the event being handled happened. an evdev keyboard stamps its
+// events itself, the mouse protocol has no times so a packet gets the time
+// the read it came in returned
+static uint64_t input_time_ns = 0;
+static bool keyboard_stamps = false;
+
+static void push_input(int type, int code, int value) {
+    int idx = get_focused_window_idx();
+    if (idx < 0) return;
+    const window_t *w = &windows[idx];
+    sqws_input_t in = {
+        .time_ns = input_time_ns,
+        .code = code,
+        .value = value,
+        .x = mouse_x - w->x - BORDER,
+        .y = mouse_y - w->y - BORDER - TITLEBAR_HEIGHT,
+        .buttons = mouse_buttons,
+    };
+    clients_push_input(type, idx, &in);
+}
+
+static loop_source_t keyboard_source = { .fd = -1 }, mouse_source = { .fd = -1 };
+
+// window being dragged with the mouse and where it was grabbed
+static int drag_window = -1, drag_dx = 0, drag_dy = 0;
+
+// window being resized by its bottom right corner, grabbed this far from it
+#define RESIZE_GRIP 12
+#define RESIZE_MIN 32
+static int resize_window = -1, resize_dx = 0, resize_dy = 0;
+
+static void keyboard_process(loop_source_t *src, uint32_t events);
+static void mouse_process(loop_source_t *src, uint32_t events);
 
 // REVIEW
 static int linux_keycode_to_vk(int linux_code) {
@@ -93,29 +139,60 @@ static int linux_keycode_to_vk(int linux_code) {
 }
 
 void restore_terminal(void) {
+    loop_remove(&keyboard_source);
     if (ev_fd >= 0) {
         close(ev_fd);
         ev_fd = -1;
     }
 }
 
+// input can also come from a file, a fifo or a listening UNIX socket that
+// speaks the same format as the device, e.g. to replay input headless
+static int open_input(const char *path) {
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) return -1;
+        struct sockaddr_un addr = { .sun_family = AF_UNIX };
+        snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+        if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 && errno != EINPROGRESS) {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+    return open(path, O_RDONLY | O_NONBLOCK);
+}
+
 bool keyboard_init(void) {
+    const char *pattern = getenv("SQWS_KEYBOARD");
+    if (!pattern) pattern = output->keyboard_dev;
+    if (!pattern) return false;
+
     glob_t glob_result;
-    int ret = glob("/dev/input/by-id/*-event-kbd", 0, NULL, &glob_result);
+    int ret = glob(pattern, 0, NULL, &glob_result);
     if (ret != 0 || glob_result.gl_pathc == 0) {
         fprintf(stderr, "no keyboard found!\n");
         globfree(&glob_result);
         return false;
     }
 
-    ev_fd = open(glob_result.gl_pathv[0], O_RDONLY | O_NONBLOCK);
+    ev_fd = open_input(glob_result.gl_pathv[0]);
     globfree(&glob_result);
 
     if (ev_fd < 0) {
         perror("open keyboard");
         return false;
     }
+    // stamped with the clock the events are delivered with. a socket
+    // replaying input isn't a device, its events are stamped when read
+    int clock = CLOCK_MONOTONIC;
+    keyboard_stamps = ioctl(ev_fd, EVIOCSCLOCKID, &clock) == 0;
 
+    if (!loop_add(&keyboard_source, ev_fd, EPOLLIN, keyboard_process, NULL)) {
+        restore_terminal();
+        return false;
+    }
     return true;
 }
 
@@ -123,103 +200,208 @@ void keyboard_cleanup(void) {
     restore_terminal();
 }
 
-void keyboard_process(client_array_t *clients) {
-    if (fds[clients->size + 1].revents & POLLIN) {
-        struct input_event ev;
-        ssize_t n = read(ev_fd, &ev, sizeof(ev));
-        if (n == sizeof(ev)) {
-            if (ev.type == EV_KEY) {
-                int vk = linux_keycode_to_vk(ev.code);
-                if (vk > 0 && vk < MAX_VK_CODE) {
-                    if (ev.value == 1) {
-                        keys_pressed[vk] = true;
-                    } else if (ev.value == 0) {
-                        keys_pressed[vk] = false;
-                    }
-                }
-            }
+static void key_event(const struct input_event *ev) {
+    if (ev->type != EV_KEY) return;
+    if (keyboard_stamps)
+        input_time_ns = (uint64_t)ev->input_event_sec * 1000000000ull + (uint64_t)ev->input_event_usec * 1000;
+    int vk = linux_keycode_to_vk(ev->code);
+    if (vk > 0 && vk < MAX_VK_CODE) {
+        push_input(SQWS_MSG_KEY, vk, ev->value);
+    }
+}
+
+// input is drained with a few large reads instead of one event per wakeup.
+// a device delivers whole records, a socket replaying input might not, so a
+// record cut in half waits in the buffer for the rest
+static void keyboard_process(loop_source_t *src, uint32_t events) {
+    static unsigned char buf[64 * sizeof(struct input_event)];
+    static size_t len = 0;
+
+    if ((events & (EPOLLHUP | EPOLLERR)) && !(events & EPOLLIN)) {
+        restore_terminal();
+        return;
+    }
+    if (!(events & EPOLLIN)) return;
+
+    for (;;) {
+        size_t room = sizeof(buf) - len;
+        ssize_t n = read(ev_fd, buf + len, room);
+        if (!keyboard_stamps) input_time_ns = clock_now_ns();
+        if (n == 0) {
+            // end of a replayed input file
+            restore_terminal();
+            len = 0;
+            return;
+        }
+        if (n < 0) return;
+        len += n;
+
+        size_t pos = 0;
+        for (; len - pos >= sizeof(struct input_event); pos += sizeof(struct input_event)) {
+            struct input_event ev;
+            memcpy(&ev, buf + pos, sizeof(ev));
+            key_event(&ev);
         }
+        memmove(buf, buf + pos, len - pos);
+        len -= pos;
+        // a short read means there's nothing left
+        if ((size_t)n < room) return;
     }
 }
 
 bool mouse_init() {
-    mouse_fd = open("/dev/input/mice", O_RDONLY | O_NONBLOCK);
+    mouse_x = motion_x = mode.hdisplay / 2;
+    mouse_y = motion_y = mode.vdisplay / 2;
 
-    mouse_x = mode.hdisplay / 2;
-    mouse_y = mode.vdisplay / 2;
+    const char *path = getenv("SQWS_MOUSE");
+    if (!path) path = output->mouse_dev;
+    if (!path) return false;
 
-    return mouse_fd >= 0 || (perror("mouse"), false);
+    mouse_fd = open_input(path);
+    if (mouse_fd < 0) {
+        perror("mouse");
+        return false;
+    }
+    if (!loop_add(&mouse_source, mouse_fd, EPOLLIN, mouse_process, NULL)) {
+        mouse_cleanup();
+        return false;
+    }
+    return true;
 }
 
 void mouse_cleanup() {
+    loop_remove(&mouse_source);
     if (mouse_fd >= 0) close(mouse_fd);
+    mouse_fd = -1;
 }
 
-void mouse_process(int *drag_window, int *dx, int *dy) {
-    struct pollfd pfd = { .fd = mouse_fd, .events = POLLIN };
-    int ret = poll(&pfd, 1, 0);
-    if (ret <= 0) return;
-
-    if (pfd.revents & POLLIN) {
-        unsigned char d[3];
-        if (read(mouse_fd, d, 3) != 3) return;
-
-        bool left = d[0] & 1;
-        int mx = (signed char)d[1];
-        int my = -(signed char)d[2];
-
-        int nx = mouse_x + mx;
-        if (nx < 0) nx = 0;
-        else if (nx >= (int)mode.hdisplay) nx = mode.hdisplay - 1;
-        mouse_x = nx;
-
-        int ny = mouse_y + my;
-        if (ny < 0) ny = 0;
-        else if (ny >= (int)mode.vdisplay) ny = mode.vdisplay - 1;
-        mouse_y = ny;
-
-        if (*drag_window != -1) {
-            window_t *w = &windows[*drag_window];
-            if (w->used) {
-                w->x = mouse_x - *dx;
-                w->y = mouse_y - *dy;
-
-                if (w->x < 0) w->x = 0;
-                if (w->y < 0) w->y = 0;
-                if (w->x + w->w > (int)mode.hdisplay) w->x = mode.hdisplay - w->w;
-                if (w->y + w->h > (int)mode.vdisplay) w->y = mode.vdisplay - w->h;
-            }
+// motion is summed up and only moves the cursor, and whatever is being
+// dragged, once per frame. a button going up or down first catches up with
+// the motion before it so clicks land where they were made
+bool mouse_motion_pending(void) {
+    return motion_x != mouse_x || motion_y != mouse_y;
+}
+
+void mouse_flush_motion(void) {
+    if (!mouse_motion_pending()) return;
+    // the cursor itself is redrawn by the output, see cursor.c
+    mouse_x = motion_x;
+    mouse_y = motion_y;
+
+    if (drag_window != -1) {
+        window_t *w = &windows[drag_window];
+        if (w->used) {
+            int wx = mouse_x - drag_dx;
+            int wy = mouse_y - drag_dy;
+
+            if (wx < 0) wx = 0;
+            if (wy < 0) wy = 0;
+            if (wx + w->w > (int)mode.hdisplay) wx = mode.hdisplay - w->w;
+            if (wy + w->h > (int)mode.vdisplay) wy = mode.vdisplay - w->h;
+            handle_move(w, wx, wy);
+        }
+    }
+    // at most one configure per frame, however fast the pointer moves
+    if (resize_window != -1) {
+        window_t *w = &windows[resize_window];
+        if (w->used) {
+            int cw = mouse_x + resize_dx - w->x - 2 * BORDER;
+            int ch = mouse_y + resize_dy - w->y - TITLEBAR_HEIGHT - 2 * BORDER;
+            if (cw < RESIZE_MIN) cw = RESIZE_MIN;
+            if (ch < RESIZE_MIN) ch = RESIZE_MIN;
+            if (cw != w->configure_w || ch != w->configure_h) window_configure(w, cw, ch);
         }
+    }
+    push_input(SQWS_MSG_MOTION, 0, 0);
+}
 
-        if (left && !mouse_left) {
-            mouse_left = true;
-            *drag_window = -1;
-
-            for (int i = MAX_WINDOWS - 1; i >= 0; i--) {
-                window_t *w = &windows[i];
-                if (!w->used) continue;
-
-                if (mouse_x >= w->x && mouse_x < w->x + w->w &&
-                    mouse_y >= w->y && mouse_y < w->y + w->h) {
-                    
-                    process_window_buttons(w, mouse_x, mouse_y);
-                    if (!w->used) break;
-
-                    *drag_window = i;
-                    *dx = mouse_x - w->x;
-                    *dy = mouse_y - w->y;
-                    
-                    for (int j = 0; j < MAX_WINDOWS; j++) {
-                        windows[j].focused = false;
-                    }
-                    w->focused = true;
-                    break;
-                }
+static void mouse_button(bool left) {
+    if (left && !mouse_left) {
+        mouse_left = true;
+        drag_window = -1;
+        resize_window = -1;
+
+        int i = grid_window_at(mouse_x, mouse_y);
+        if (i >= 0) {
+            window_t *w = &windows[i];
+            process_window_buttons(w, mouse_x, mouse_y);
+            // a fullscreen window stays put, clicks only go to the client
+            bool grab = w->used && !w->fullscreen;
+            if (grab && !w->minimized && !w->maximized &&
+                mouse_x >= w->x + w->w - RESIZE_GRIP && mouse_y >= w->y + w->h - RESIZE_GRIP) {
+                resize_window = i;
+                resize_dx = w->x + w->w - mouse_x;
+                resize_dy = w->y + w->h - mouse_y;
+            } else if (grab) {
+                drag_window = i;
+                drag_dx = mouse_x - w->x;
+                drag_dy = mouse_y - w->y;
             }
+            if (w->used) window_focus(i);
         }
-        else if (!left && mouse_left) {
-            mouse_left = false;
-            *drag_window = -1;
+    }
+    else if (!left && mouse_left) {
+        mouse_left = false;
+        drag_window = -1;
+        resize_window = -1;
+    }
+}
+
+static void mouse_packet(const unsigned char *d) {
+    // the packet's button bits are left, right, middle like SQWS_BUTTON_*
+    unsigned buttons = d[0] & 7;
+    int mx = (signed char)d[1];
+    int my = -(signed char)d[2];
+
+    // clamped per packet, pushing against an edge doesn't build up
+    motion_x += mx;
+    if (motion_x < 0) motion_x = 0;
+    else if (motion_x >= (int)mode.hdisplay) motion_x = mode.hdisplay - 1;
+
+    motion_y += my;
+    if (motion_y < 0) motion_y = 0;
+    else if (motion_y >= (int)mode.vdisplay) motion_y = mode.vdisplay - 1;
+
+    if (buttons != mouse_buttons) {
+        mouse_flush_motion();
+        unsigned changed = buttons ^ mouse_buttons;
+        // a click can move the focus, so the window manager goes first and the
+        // press goes to the window that was clicked
+        mouse_button(buttons & SQWS_BUTTON_LEFT);
+        for (unsigned b = SQWS_BUTTON_LEFT; b <= SQWS_BUTTON_MIDDLE; b <<= 1) {
+            if (!(changed & b)) continue;
+            mouse_buttons ^= b;
+            push_input(SQWS_MSG_BUTTON, b, (buttons & b) != 0);
+        }
+    }
+}
+
+static void mouse_process(loop_source_t *src, uint32_t events) {
+    static unsigned char buf[3 * 256];
+    static size_t len = 0;
+
+    if ((events & (EPOLLHUP | EPOLLERR)) && !(events & EPOLLIN)) {
+        mouse_cleanup();
+        return;
+    }
+    if (!(events & EPOLLIN)) return;
+
+    for (;;) {
+        size_t room = sizeof(buf) - len;
+        ssize_t n = read(mouse_fd, buf + len, room);
+        input_time_ns = clock_now_ns();
+        if (n == 0) {
+            mouse_cleanup();
+            len = 0;
+            return;
         }
+        if (n < 0) return;
+        len += n;
+
+        size_t pos = 0;
+        for (; len - pos >= 3; pos += 3) mouse_packet(buf + pos);
+        memmove(buf, buf + pos, len - pos);
+        len -= pos;
+        if ((size_t)n < room) return;
     }
 }
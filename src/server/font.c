@@ -0,0 +1,183 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "draw.h"
+#include "fonts.h"
+#include "ter-u16n.h"
+
+font_t font;
+
+static void *font_map = NULL;
+static size_t font_map_size = 0;
+
+// row_masks[bits][col] is all ones where bit 7 - col of a glyph row is set,
+// so a glyph row is drawn as a masked store of 8 pixels instead of 8 tests
+static uint32_t row_masks[256][8];
+
+static bool font_load(const void *data, size_t size, const char *name) {
+    const font_blob_t *hdr = data;
+    if (size < sizeof(*hdr) || memcmp(hdr->magic, FONT_MAGIC, 4) != 0) {
+        fprintf(stderr, "%s: not a font blob\n", name);
+        return false;
+    }
+    if (hdr->version != FONT_VERSION || !hdr->width || hdr->width > 8 || !hdr->height) {
+        fprintf(stderr, "%s: unsupported font (version %u, %ux%u)\n", name,
+                hdr->version, hdr->width, hdr->height);
+        return false;
+    }
+    size_t pages_size = (size_t)hdr->page_count * 256 * sizeof(uint16_t);
+    size_t glyphs_size = (size_t)hdr->glyph_count * hdr->height;
+    if (!hdr->glyph_count || hdr->default_glyph >= hdr->glyph_count ||
+        size < sizeof(*hdr) + pages_size + glyphs_size) {
+        fprintf(stderr, "%s: truncated font blob\n", name);
+        return false;
+    }
+
+    const uint16_t *pages = (const uint16_t *)(hdr + 1);
+    for (int i = 0; i < 256; i++) {
+        if (hdr->page_map[i] != FONT_NONE && hdr->page_map[i] >= hdr->page_count) {
+            fprintf(stderr, "%s: bad page index\n", name);
+            return false;
+        }
+    }
+    for (size_t i = 0; i < (size_t)hdr->page_count * 256; i++) {
+        if (pages[i] != FONT_NONE && pages[i] >= hdr->glyph_count) {
+            fprintf(stderr, "%s: bad glyph index\n", name);
+            return false;
+        }
+    }
+
+    font.width = hdr->width;
+    font.height = hdr->height;
+    font.page_map = hdr->page_map;
+    font.pages = pages;
+    font.glyphs = (const uint8_t *)pages + pages_size;
+    font.glyph_count = hdr->glyph_count;
+    font.default_glyph = hdr->default_glyph;
+    return true;
+}
+
+static bool font_load_file(const char *path) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) { perror(path); return false; }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+        fprintf(stderr, "%s: empty font blob\n", path);
+        close(fd);
+        return false;
+    }
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) { perror("mmap font"); return false; }
+    if (!font_load(map, st.st_size, path)) {
+        munmap(map, st.st_size);
+        return false;
+    }
+    font_map = map;
+    font_map_size = st.st_size;
+    return true;
+}
+
+bool font_init(void) {
+    for (int bits = 0; bits < 256; bits++)
+        for (int col = 0; col < 8; col++)
+            row_masks[bits][col] = (bits & (0x80 >> col)) ? 0xFFFFFFFF : 0;
+
+    const char *path = getenv("SQWS_FONT");
+    if (path && font_load_file(path)) return true;
+    if (path) fprintf(stderr, "falling back to the built-in font\n");
+    return font_load(ter_u16n_blob, sizeof(ter_u16n_blob), "built-in font");
+}
+
+void font_cleanup(void) {
+    if (font_map) munmap(font_map, font_map_size);
+    font_map = NULL;
+}
+
+//=======================================================================
+
+uint32_t utf8_next(const char **s) {
+    const unsigned char *p = (const unsigned char *)*s;
+    uint32_t cp = p[0];
+    int len;
+    if (cp < 0x80) { *s += cp != 0; return cp; }
+    else if ((cp & 0xE0) == 0xC0) { len = 2; cp &= 0x1F; }
+    else if ((cp & 0xF0) == 0xE0) { len = 3; cp &= 0x0F; }
+    else if ((cp & 0xF8) == 0xF0) { len = 4; cp &= 0x07; }
+    else { *s += 1; return 0xFFFD; }
+
+    for (int i = 1; i < len; i++) {
+        if ((p[i] & 0xC0) != 0x80) { *s += 1; return 0xFFFD; }
+        cp = (cp << 6) | (p[i] & 0x3F);
+    }
+    // overlong forms, surrogates and anything past U+10FFFF
+    static const uint32_t min_cp[5] = {0, 0, 0x80, 0x800, 0x10000};
+    if (cp < min_cp[len] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        *s += 1;
+        return 0xFFFD;
+    }
+    *s += len;
+    return cp;
+}
+
+int utf8_len(const char *s) {
+    int n = 0;
+    while (*s) { utf8_next(&s); n++; }
+    return n;
+}
+
+int utf8_trim(const char *s, int max) {
+    int n = 0;
+    while (n < max && s[n]) {
+        const char *p = s + n;
+        utf8_next(&p);
+        if (p - s > max) break;
+        n = p - s;
+    }
+    return n;
+}
+
+//=======================================================================
+
+void draw_char(unsigned char *buf, int x, int y, uint32_t cp, const unsigned char *color, int pitch, int sw, int sh) {
+    int fw = font.width, fh = font.height;
+    if (x >= sw || y >= sh) return;
+    if (x + fw <= 0 || y + fh <= 0) return;
+
+    const uint8_t *glyph = font_glyph(cp);
+    uint32_t c = *(const uint32_t *)color;
+    int row0 = y < 0 ? -y : 0, row1 = y + fh > sh ? sh - y : fh;
+    int col0 = x < 0 ? -x : 0, col1 = x + fw > sw ? sw - x : fw;
+
+    for (int row = row0; row < row1; row++) {
+        unsigned bits = glyph[row];
+        if (!bits) continue;
+        const uint32_t *m = row_masks[bits];
+        uint32_t *dst = (uint32_t *)(buf + (y + row) * pitch) + x;
+        if (col0 == 0 && col1 == 8) {
+            for (int col = 0; col < 8; col++)
+                dst[col] = (dst[col] & ~m[col]) | (c & m[col]);
+        } else {
+            for (int col = col0; col < col1; col++)
+                dst[col] = (dst[col] & ~m[col]) | (c & m[col]);
+        }
+    }
+}
+
+void draw_text(unsigned char *buf, int x, int y, const char *text, const unsigned char *color, int pitch, int sw, int sh) {
+    if (y >= sh || y + font.height <= 0) return;
+    while (*text && x < sw) {
+        uint32_t cp = utf8_next(&text);
+        draw_char(buf, x, y, cp, color, pitch, sw, sh);
+        x += font.width;
+    }
+}
+
+int text_width(const char *text) {
+    return utf8_len(text) * font.width;
+}
@@ -0,0 +1,184 @@
+#include "wm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// a uniform grid of GRID_CELL sized cells over the screen, each listing the
+// windows whose frame overlaps it. it is kept up to date from
+// window_update_geom, so finding the windows at a point or in a rect only
+// looks at the windows near it instead of all of them
+//
+// parts of windows off the screen aren't in the grid, nothing is looked up
+// there. lookups only read, so compose threads can share the grid
+
+#define GRID_CELL 128
+
+typedef struct {
+    int *slots;
+    int count, cap;
+} cell_t;
+
+static cell_t *cells;
+static int cols, rows;
+
+// cells each slot is listed in, x1 and y1 exclusive
+static rect_t *ranges;
+static int range_cap;
+
+static bool cell_add(cell_t *c, int slot) {
+    if (c->count == c->cap) {
+        int cap = c->cap ? c->cap * 2 : 8;
+        int *slots = realloc(c->slots, cap * sizeof(*slots));
+        if (!slots) return false;
+        c->slots = slots;
+        c->cap = cap;
+    }
+    c->slots[c->count++] = slot;
+    return true;
+}
+
+static void cell_remove(cell_t *c, int slot) {
+    for (int i = 0; i < c->count; i++) {
+        if (c->slots[i] == slot) {
+            c->slots[i] = c->slots[--c->count];
+            return;
+        }
+    }
+}
+
+// the cells a screen rect touches, empty when it is off the screen
+static rect_t cell_range(int x0, int y0, int x1, int y1) {
+    rect_t r = {
+        x0 < 0 ? 0 : x0 / GRID_CELL, y0 < 0 ? 0 : y0 / GRID_CELL,
+        x1 <= 0 ? 0 : (x1 - 1) / GRID_CELL + 1, y1 <= 0 ? 0 : (y1 - 1) / GRID_CELL + 1,
+    };
+    if (r.x1 > cols) r.x1 = cols;
+    if (r.y1 > rows) r.y1 = rows;
+    if (r.x0 >= r.x1 || r.y0 >= r.y1) r = (rect_t){0};
+    return r;
+}
+
+static void grid_remove(int slot) {
+    rect_t *r = &ranges[slot];
+    for (int y = r->y0; y < r->y1; y++)
+        for (int x = r->x0; x < r->x1; x++)
+            cell_remove(&cells[y * cols + x], slot);
+    *r = (rect_t){0};
+}
+
+static void grid_insert(int slot) {
+    if (!(window_geom.flags[slot] & GEOM_USED)) return;
+    int x = window_geom.x[slot], y = window_geom.y[slot];
+    rect_t r = cell_range(x, y, x + window_geom.w[slot], y + window_geom.h[slot]);
+    for (int cy = r.y0; cy < r.y1; cy++) {
+        for (int cx = r.x0; cx < r.x1; cx++) {
+            if (!cell_add(&cells[cy * cols + cx], slot)) {
+                // remembers the rows it got into, so it can be removed again
+                fprintf(stderr, "out of memory for the window grid\n");
+                r.y1 = cy + 1;
+                ranges[slot] = r;
+                return;
+            }
+        }
+    }
+    ranges[slot] = r;
+}
+
+// sizes the grid to the screen and lists every window again
+static bool grid_rebuild(void) {
+    int c = (mode.hdisplay + GRID_CELL - 1) / GRID_CELL, r = (mode.vdisplay + GRID_CELL - 1) / GRID_CELL;
+    for (int i = 0; i < cols * rows; i++) free(cells[i].slots);
+    free(cells);
+    cols = rows = 0;
+    cells = calloc((size_t)c * r, sizeof(*cells));
+    if (!cells) {
+        fprintf(stderr, "out of memory for the window grid\n");
+        return false;
+    }
+    cols = c;
+    rows = r;
+    memset(ranges, 0, range_cap * sizeof(*ranges));
+    for (int i = window_top(); i >= 0; i = window_below(i)) grid_insert(i);
+    return true;
+}
+
+void grid_update(int slot) {
+    if (slot >= range_cap) {
+        int cap = window_slots;
+        rect_t *r = realloc(ranges, cap * sizeof(*r));
+        if (!r) {
+            fprintf(stderr, "out of memory for the window grid\n");
+            return;
+        }
+        memset(r + range_cap, 0, (cap - range_cap) * sizeof(*r));
+        ranges = r;
+        range_cap = cap;
+    }
+    if (cols != (mode.hdisplay + GRID_CELL - 1) / GRID_CELL || rows != (mode.vdisplay + GRID_CELL - 1) / GRID_CELL) {
+        grid_rebuild();
+        return;
+    }
+    grid_remove(slot);
+    grid_insert(slot);
+}
+
+void grid_cleanup(void) {
+    for (int i = 0; i < cols * rows; i++) free(cells[i].slots);
+    free(cells);
+    free(ranges);
+    cells = NULL;
+    ranges = NULL;
+    cols = rows = range_cap = 0;
+}
+
+static bool contains(int slot, int x, int y) {
+    return x >= window_geom.x[slot] && x < window_geom.x[slot] + window_geom.w[slot] &&
+           y >= window_geom.y[slot] && y < window_geom.y[slot] + window_geom.h[slot];
+}
+
+int grid_window_at(int x, int y) {
+    if (x < 0 || y < 0 || x / GRID_CELL >= cols || y / GRID_CELL >= rows) return -1;
+    const cell_t *c = &cells[y / GRID_CELL * cols + x / GRID_CELL];
+    int top = -1;
+    for (int i = 0; i < c->count; i++) {
+        int slot = c->slots[i];
+        if (contains(slot, x, y) && (top < 0 || window_geom.z[slot] > window_geom.z[top])) top = slot;
+    }
+    return top;
+}
+
+static int above_first(const void *a, const void *b) {
+    int64_t za = window_geom.z[*(const int *)a], zb = window_geom.z[*(const int *)b];
+    return za < zb ? 1 : za > zb ? -1 : 0;
+}
+
+// a window spanning several of the cells is only taken from the first one
+// it shares with r, so it comes up once without having to remember it
+bool grid_query(const rect_t *r, slot_list_t *out) {
+    out->count = 0;
+    rect_t q = cell_range(r->x0, r->y0, r->x1, r->y1);
+    for (int cy = q.y0; cy < q.y1; cy++) {
+        for (int cx = q.x0; cx < q.x1; cx++) {
+            const cell_t *c = &cells[cy * cols + cx];
+            for (int i = 0; i < c->count; i++) {
+                int slot = c->slots[i];
+                const rect_t *w = &ranges[slot];
+                if ((w->x0 > q.x0 ? w->x0 : q.x0) != cx || (w->y0 > q.y0 ? w->y0 : q.y0) != cy) continue;
+                int x = window_geom.x[slot], y = window_geom.y[slot];
+                if (x >= r->x1 || y >= r->y1 || x + window_geom.w[slot] <= r->x0 || y + window_geom.h[slot] <= r->y0)
+                    continue;
+                if (out->count == out->cap) {
+                    int cap = out->cap ? out->cap * 2 : 64;
+                    int *items = realloc(out->items, cap * sizeof(*items));
+                    if (!items) return false;
+                    out->items = items;
+                    out->cap = cap;
+                }
+                out->items[out->count++] = slot;
+            }
+        }
+    }
+    qsort(out->items, out->count, sizeof(*out->items), above_first);
+    return true;
+}
@@ -0,0 +1,187 @@
+#define _GNU_SOURCE
+#include "wm.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// an output without a display: frames go to a memfd, vblanks come from a
+// timer running at the configured refresh rate. configured through
+//   SQWS_HEADLESS_MODE  WxH or WxH@Hz, default 1920x1080@60
+//   SQWS_DUMP           directory to write every presented frame to as PPM
+
+static int fb_memfd = -1;
+static unsigned char *fb_map = NULL;
+static size_t fb_size = 0;
+static int fb_pitch = 0;
+static cursor_save_t cursor;
+// a shared canvas the last frame showed as it is, instead of fb_map
+static const unsigned char *scanout;
+
+static int timer_fd = -1;
+static uint64_t refresh_ns = 0;
+static uint64_t vblank_epoch = 0;
+static uint64_t next_vblank = 0;
+static frame_sched_t *pending = NULL;
+
+static const char *dump_dir = NULL;
+static unsigned frame_count = 0;
+
+static bool headless_init(void) {
+    unsigned w = 1920, h = 1080, hz = 60;
+    const char *m = getenv("SQWS_HEADLESS_MODE");
+    if (m && sscanf(m, "%ux%u@%u", &w, &h, &hz) < 2) {
+        fprintf(stderr, "bad SQWS_HEADLESS_MODE %s, want WxH@Hz\n", m);
+        return false;
+    }
+    if (!w || !h || w > SQWS_MAX_CANVAS || h > SQWS_MAX_CANVAS || !hz) {
+        fprintf(stderr, "unsupported headless mode %ux%u@%u\n", w, h, hz);
+        return false;
+    }
+
+    memset(&mode, 0, sizeof(mode));
+    mode.hdisplay = w;
+    mode.vdisplay = h;
+    mode.vrefresh = hz;
+    snprintf(mode.name, sizeof(mode.name), "%ux%u", w, h);
+
+    fb_pitch = w * 4;
+    fb_size = (size_t)fb_pitch * h;
+    fb_memfd = memfd_create("sqws-headless", MFD_CLOEXEC);
+    if (fb_memfd < 0) { perror("memfd_create"); return false; }
+    if (ftruncate(fb_memfd, fb_size) < 0) { perror("ftruncate"); return false; }
+    fb_map = mmap(NULL, fb_size, PROT_READ | PROT_WRITE, MAP_SHARED, fb_memfd, 0);
+    if (fb_map == MAP_FAILED) {
+        perror("mmap");
+        fb_map = NULL;
+        return false;
+    }
+
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timer_fd < 0) { perror("timerfd_create"); return false; }
+    refresh_ns = mode_refresh_ns(&mode);
+    vblank_epoch = clock_now_ns();
+
+    dump_dir = getenv("SQWS_DUMP");
+    printf("headless output %ux%u@%u\n", w, h, hz);
+    return true;
+}
+
+static void headless_cleanup(void) {
+    cursor_save_free(&cursor);
+    if (fb_map) munmap(fb_map, fb_size);
+    fb_map = NULL;
+    if (fb_memfd >= 0) close(fb_memfd);
+    fb_memfd = -1;
+    if (timer_fd >= 0) close(timer_fd);
+    timer_fd = -1;
+}
+
+static unsigned char *headless_begin_frame(const damage_t *damage, damage_t *repaint, int *pitch) {
+    // a single buffer that is never scanned out, it is always up to date
+    scanout = NULL;
+    cursor_erase(&cursor, fb_map, fb_pitch, damage, NULL);
+    *repaint = *damage;
+    *pitch = fb_pitch;
+    return fb_map;
+}
+
+static bool headless_bypass(const window_t *w, const damage_t *damage, bool *zero_copy) {
+    // with no cursor to draw over it a shared canvas is the frame
+    if (w->shm_map && !cursor_shown()) {
+        scanout = w->canvas;
+        *zero_copy = true;
+        return true;
+    }
+    // fb_map fell behind while a canvas was shown instead
+    damage_t all = {0};
+    if (scanout) damage_add(&all, 0, 0, mode.hdisplay, mode.vdisplay);
+    const damage_t *region = scanout ? &all : damage;
+    scanout = NULL;
+    cursor_erase(&cursor, fb_map, fb_pitch, region, NULL);
+    fb_copy_canvas(fb_map, fb_pitch, w, region);
+    return true;
+}
+
+static void dump_frame(void) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/frame-%06u.ppm", dump_dir, frame_count);
+    FILE *f = fopen(path, "wb");
+    if (!f) { perror("dump frame"); return; }
+
+    fprintf(f, "P6\n%d %d\n255\n", mode.hdisplay, mode.vdisplay);
+    unsigned char *row = malloc(mode.hdisplay * 3);
+    const unsigned char *frame = scanout ? scanout : fb_map;
+    int pitch = scanout ? mode.hdisplay * 4 : fb_pitch;
+    for (int y = 0; row && y < mode.vdisplay; y++) {
+        const unsigned char *src = frame + (size_t)y * pitch;
+        for (int x = 0; x < mode.hdisplay; x++) {
+            row[x * 3 + 0] = src[x * 4 + 2];
+            row[x * 3 + 1] = src[x * 4 + 1];
+            row[x * 3 + 2] = src[x * 4 + 0];
+        }
+        fwrite(row, 3, mode.hdisplay, f);
+    }
+    free(row);
+    fclose(f);
+}
+
+static bool headless_present(void *ctx, frame_sched_t *sched) {
+    if (!scanout) cursor_draw(&cursor, fb_map, fb_pitch, NULL);
+    if (dump_dir) dump_frame();
+    frame_count++;
+
+    // complete the frame on the next simulated vblank
+    uint64_t now = clock_now_ns();
+    next_vblank = vblank_epoch + ((now - vblank_epoch) / refresh_ns + 1) * refresh_ns;
+    struct itimerspec its = {
+        .it_value = {
+            .tv_sec = next_vblank / 1000000000ull,
+            .tv_nsec = next_vblank % 1000000000ull,
+        },
+    };
+    if (timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+        perror("timerfd_settime");
+        return false;
+    }
+    pending = sched;
+    return true;
+}
+
+static uint64_t headless_now(void *ctx) {
+    return clock_now_ns();
+}
+
+static int headless_event_fd(void *ctx) {
+    return timer_fd;
+}
+
+static void headless_dispatch(void *ctx) {
+    uint64_t expirations;
+    if (read(timer_fd, &expirations, sizeof(expirations)) != sizeof(expirations)) return;
+    if (pending) {
+        frame_sched_t *s = pending;
+        pending = NULL;
+        sched_frame_done(s, next_vblank);
+    }
+}
+
+static const presenter_t headless_presenter = {
+    .now = headless_now,
+    .present = headless_present,
+    .event_fd = headless_event_fd,
+    .dispatch = headless_dispatch,
+};
+
+const output_backend_t headless_backend = {
+    .name = "headless",
+    .init = headless_init,
+    .cleanup = headless_cleanup,
+    .begin_frame = headless_begin_frame,
+    .presenter = &headless_presenter,
+    .bypass = headless_bypass,
+};
@@ -0,0 +1,153 @@
+#include "wm.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+// every fd the server waits on is registered once with a callback. a wakeup
+// only costs the fds that are actually ready
+//
+// sources can also be deferred: they are called again on the next dispatch
+// without waiting, with no events, for work that was cut short by a budget.
+// fds epoll can't watch, regular files used to replay input, are treated as
+// always readable and stay deferred for as long as they are registered
+
+#define MAX_EVENTS 64
+
+static int epoll_fd = -1;
+
+// the batch being dispatched, sources removed meanwhile are nulled out
+static struct epoll_event events[MAX_EVENTS];
+static int event_count = 0;
+
+typedef struct {
+    loop_source_t **items;
+    int count, cap;
+} source_list_t;
+
+// deferred for the next dispatch, and the ones being called right now
+static source_list_t deferred, running;
+
+bool loop_init(void) {
+    epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        perror("epoll_create1");
+        return false;
+    }
+    return true;
+}
+
+void loop_cleanup(void) {
+    if (epoll_fd >= 0) close(epoll_fd);
+    epoll_fd = -1;
+    free(deferred.items);
+    free(running.items);
+    deferred = running = (source_list_t){0};
+    event_count = 0;
+}
+
+static bool list_push(source_list_t *l, loop_source_t *src) {
+    if (l->count == l->cap) {
+        int cap = l->cap ? l->cap * 2 : 16;
+        loop_source_t **items = realloc(l->items, cap * sizeof(*items));
+        if (!items) {
+            fprintf(stderr, "out of memory for deferred sources\n");
+            return false;
+        }
+        l->items = items;
+        l->cap = cap;
+    }
+    l->items[l->count++] = src;
+    return true;
+}
+
+bool loop_add(loop_source_t *src, int fd, uint32_t events, loop_fn_t fn, void *data) {
+    *src = (loop_source_t){ .fd = fd, .events = events, .fn = fn, .data = data, .polled = true };
+    struct epoll_event ev = { .events = events, .data.ptr = src };
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        if (errno != EPERM) {
+            perror("epoll_ctl");
+            src->fd = -1;
+            return false;
+        }
+        src->polled = false;
+        if (!loop_defer(src)) {
+            src->fd = -1;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool loop_modify(loop_source_t *src, uint32_t events) {
+    if (src->fd < 0 || src->events == events) return true;
+    src->events = events;
+    if (!src->polled) return true;
+    struct epoll_event ev = { .events = events, .data.ptr = src };
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, src->fd, &ev) < 0) {
+        perror("epoll_ctl");
+        return false;
+    }
+    return true;
+}
+
+static void list_remove(source_list_t *l, loop_source_t *src) {
+    for (int i = 0; i < l->count; i++)
+        if (l->items[i] == src) l->items[i] = NULL;
+}
+
+// safe to call from any callback, on any source, and more than once
+void loop_remove(loop_source_t *src) {
+    if (src->fd < 0) return;
+    if (src->polled) epoll_ctl(epoll_fd, EPOLL_CTL_DEL, src->fd, NULL);
+    for (int i = 0; i < event_count; i++)
+        if (events[i].data.ptr == src) events[i].data.ptr = NULL;
+    if (src->deferred) list_remove(&deferred, src);
+    list_remove(&running, src);
+    src->deferred = false;
+    src->fd = -1;
+}
+
+bool loop_defer(loop_source_t *src) {
+    if (src->fd < 0 || src->deferred) return true;
+    if (!list_push(&deferred, src)) return false;
+    src->deferred = true;
+    return true;
+}
+
+int loop_dispatch(int timeout_ms) {
+    if (deferred.count) timeout_ms = 0;
+
+    int n = epoll_wait(epoll_fd, events, MAX_EVENTS, timeout_ms);
+    if (n < 0) return errno == EINTR ? 0 : -1;
+
+    event_count = n;
+    for (int i = 0; i < n; i++) {
+        loop_source_t *src = events[i].data.ptr;
+        if (src) src->fn(src, events[i].events);
+    }
+    event_count = 0;
+
+    // what gets deferred from here on waits for the next dispatch
+    source_list_t l = running;
+    running = deferred;
+    deferred = l;
+    deferred.count = 0;
+    for (int i = 0; i < running.count; i++)
+        if (running.items[i]) running.items[i]->deferred = false;
+
+    for (int i = 0; i < running.count; i++) {
+        loop_source_t *src = running.items[i];
+        if (!src) continue;
+        if (!src->polled) {
+            loop_defer(src);
+            src->fn(src, EPOLLIN);
+        } else {
+            src->fn(src, 0);
+        }
+    }
+    running.count = 0;
+    return n;
+}
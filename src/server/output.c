@@ -0,0 +1,55 @@
+#include "wm.h"
+#include "draw.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+drmModeModeInfo mode;
+
+const output_backend_t *output = NULL;
+
+static const output_backend_t *backends[] = {
+    &drm_backend,
+    &headless_backend,
+};
+
+bool fb_init() {
+    const char *name = getenv("SQWS_BACKEND");
+    output = backends[0];
+    if (name) {
+        output = NULL;
+        for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); i++)
+            if (!strcmp(backends[i]->name, name)) output = backends[i];
+        if (!output) {
+            fprintf(stderr, "unknown output backend %s\n", name);
+            return false;
+        }
+    }
+    return output->init();
+}
+
+void fb_cleanup() {
+    free_windows();
+    grid_cleanup();
+    if (output) output->cleanup();
+    output = NULL;
+    surface_cleanup();
+}
+
+unsigned char *fb_begin_frame(const damage_t *damage, damage_t *repaint, int *pitch) {
+    return output->begin_frame(damage, repaint, pitch);
+}
+
+bool fb_bypass(const window_t *w, const damage_t *damage, bool *zero_copy) {
+    return output->bypass && output->bypass(w, damage, zero_copy);
+}
+
+void fb_copy_canvas(unsigned char *dst, int pitch, const window_t *w, const damage_t *region) {
+    for (int i = 0; i < region->count; i++) {
+        const rect_t *r = &region->rects[i];
+        blit_rect(dst + (size_t)r->y0 * pitch + r->x0 * 4, pitch,
+                  w->canvas + ((size_t)r->y0 * w->canvas_w + r->x0) * 4, w->canvas_w * 4,
+                  r->x1 - r->x0, r->y1 - r->y0, SQWS_SURFACE_OPAQUE);
+    }
+}
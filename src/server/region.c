@@ -0,0 +1,68 @@
+#include "wm.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// regions are lists of disjoint rects. subtracting a rect splits each rect it
+// overlaps into at most four pieces: the bands above and below the hole and
+// the parts left and right of it
+
+static bool region_reserve(region_t *r, int count) {
+    if (count <= r->cap) return true;
+    int cap = r->cap ? r->cap : 16;
+    while (cap < count) cap *= 2;
+    rect_t *rects = realloc(r->rects, cap * sizeof(*rects));
+    if (!rects) {
+        fprintf(stderr, "out of memory for region\n");
+        return false;
+    }
+    r->rects = rects;
+    r->cap = cap;
+    return true;
+}
+
+bool region_set(region_t *r, const rect_t *rect) {
+    r->count = 0;
+    if (rect->x1 <= rect->x0 || rect->y1 <= rect->y0) return true;
+    if (!region_reserve(r, 1)) return false;
+    r->rects[r->count++] = *rect;
+    return true;
+}
+
+bool region_subtract(region_t *r, const rect_t *hole) {
+    int n = r->count;
+    for (int i = 0; i < n; ) {
+        rect_t a = r->rects[i];
+        if (hole->x0 >= a.x1 || hole->x1 <= a.x0 || hole->y0 >= a.y1 || hole->y1 <= a.y0) {
+            i++;
+            continue;
+        }
+
+        rect_t pieces[4];
+        int count = 0;
+        int y0 = hole->y0 > a.y0 ? hole->y0 : a.y0;
+        int y1 = hole->y1 < a.y1 ? hole->y1 : a.y1;
+        if (a.y0 < y0) pieces[count++] = (rect_t){a.x0, a.y0, a.x1, y0};
+        if (y1 < a.y1) pieces[count++] = (rect_t){a.x0, y1, a.x1, a.y1};
+        if (a.x0 < hole->x0) pieces[count++] = (rect_t){a.x0, y0, hole->x0, y1};
+        if (hole->x1 < a.x1) pieces[count++] = (rect_t){hole->x1, y0, a.x1, y1};
+
+        // the first piece takes the rect's slot, the rest go to the end where
+        // they aren't visited again, they can't overlap the hole
+        if (!count) {
+            r->rects[i] = r->rects[--n];
+            r->rects[n] = r->rects[--r->count];
+            continue;
+        }
+        if (!region_reserve(r, r->count + count - 1)) return false;
+        r->rects[i++] = pieces[0];
+        for (int k = 1; k < count; k++) r->rects[r->count++] = pieces[k];
+    }
+    return true;
+}
+
+void region_free(region_t *r) {
+    free(r->rects);
+    r->rects = NULL;
+    r->count = r->cap = 0;
+}
@@ -0,0 +1,72 @@
+#include "wm.h"
+
+#include <time.h>
+
+// start composing this long before the vblank the frame is meant for
+#define REPAINT_MARGIN_NS 4000000ull
+
+uint64_t clock_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+uint64_t mode_refresh_ns(const drmModeModeInfo *m) {
+    if (m->clock && m->htotal && m->vtotal)
+        return (uint64_t)m->htotal * m->vtotal * 1000000ull / m->clock;
+    return 1000000000ull / (m->vrefresh ? m->vrefresh : 60);
+}
+
+void sched_init(frame_sched_t *s, const presenter_t *p, uint64_t refresh_ns) {
+    s->presenter = p;
+    s->refresh_ns = refresh_ns;
+    s->margin_ns = REPAINT_MARGIN_NS < refresh_ns / 2 ? REPAINT_MARGIN_NS : refresh_ns / 2;
+    s->last_vblank_ns = 0;
+    s->frame_pending = false;
+    s->frames_presented = 0;
+    s->frames_done = 0;
+}
+
+uint64_t sched_deadline(const frame_sched_t *s, bool dirty) {
+    // nothing to show, or the previous frame still owns the back buffer
+    if (!dirty || s->frame_pending) return SCHED_NEVER;
+
+    uint64_t deadline = s->last_vblank_ns + s->refresh_ns - s->margin_ns;
+    uint64_t now = s->presenter->now(s->presenter->ctx);
+
+    // idle for longer than a refresh, the next vblank is up for grabs
+    if (now - s->last_vblank_ns >= s->refresh_ns) return now;
+    return deadline;
+}
+
+int sched_timeout_ms(const frame_sched_t *s, bool dirty) {
+    uint64_t deadline = sched_deadline(s, dirty);
+    if (deadline == SCHED_NEVER) return -1;
+
+    uint64_t now = s->presenter->now(s->presenter->ctx);
+    if (deadline <= now) return 0;
+    return (int)((deadline - now + 999999) / 1000000);
+}
+
+bool sched_repaint_due(const frame_sched_t *s, bool dirty) {
+    uint64_t deadline = sched_deadline(s, dirty);
+    return deadline != SCHED_NEVER && deadline <= s->presenter->now(s->presenter->ctx);
+}
+
+bool sched_present(frame_sched_t *s) {
+    // set first, the presenter may complete the frame synchronously
+    s->frame_pending = true;
+    s->frames_presented++;
+    if (!s->presenter->present(s->presenter->ctx, s)) {
+        // retry on the next refresh instead of spinning
+        sched_frame_done(s, s->presenter->now(s->presenter->ctx));
+        return false;
+    }
+    return true;
+}
+
+void sched_frame_done(frame_sched_t *s, uint64_t vblank_ns) {
+    s->frame_pending = false;
+    s->frames_done++;
+    s->last_vblank_ns = vblank_ns;
+}
@@ -1,9 +1,13 @@
 #include "wm.h"
+#include <errno.h>
 #include <fcntl.h>
+#include <linux/udmabuf.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 unsigned char *screen_buffer = NULL;
@@ -11,7 +15,8 @@ unsigned char *screen_buffer = NULL;
 static int drm_fd = -1;
 static uint32_t crtc_id = 0;
 static uint32_t connector_id = 0;
-drmModeModeInfo mode;
+
+#define NUM_BUFFERS 2
 
 static struct {
     uint32_t handle;
@@ -21,10 +26,66 @@ static struct {
     uint32_t pitch;
     size_t size;
     void *map;
-} dumb_buf[2];
+    int age; // frames since this buffer was last shown, 0 = contents unknown
+    cursor_save_t cursor;
+} dumb_buf[NUM_BUFFERS];
 
 static int front_buf = 0;
 
+// shadow: compose into screen_buffer and copy the stale parts of the back buffer
+// direct: compose straight into the mapped back buffer. saves a copy per frame but
+//         blending reads the dumb buffer back, which is slow on write-combined maps
+static enum { PRESENT_SHADOW, PRESENT_DIRECT } present_mode = PRESENT_SHADOW;
+
+// damage of the previously presented frames, [0] is the last one
+static damage_t damage_history[NUM_BUFFERS];
+static damage_t frame_damage, frame_region;
+// what the cursor changed in the back buffer this frame
+static damage_t cursor_region;
+static bool dirtyfb_supported = true;
+
+// what the back buffer holds this frame: a composed frame, the canvas of a
+// window covering the output copied in, or nothing because that canvas is
+// scanned out as it is from the client's memfd, through a udmabuf
+static enum { FRAME_COMPOSED, FRAME_COPIED, FRAME_SCANOUT } frame_kind;
+static int scanout_slot;
+static uint64_t present_count = 0;
+
+// framebuffers made of shared canvases, kept while they are flipped between.
+// each keeps a dup of the memfd so its inode can't be reused for another
+#define SCANOUT_SLOTS 4
+
+static struct {
+    int fd; // -1 for a free slot
+    dev_t dev;
+    ino_t ino;
+    size_t offset;
+    uint32_t handle;
+    uint32_t fb_id;
+    uint64_t frame; // present_count when last shown
+} scanout[SCANOUT_SLOTS];
+
+static int udmabuf_fd = -1;
+static bool scanout_supported = true;
+
+// the pointer over a scanned out canvas goes on the cursor plane, as there is
+// no buffer of ours to draw it into. it is off whenever a dumb buffer is
+// shown, cursor.c draws it into those
+static struct {
+    uint32_t handle;
+    uint32_t width;
+    uint32_t height;
+    uint32_t pitch;
+    size_t size;
+    void *map;
+    uint32_t gen; // of the sprite in the buffer, 0 before there is one
+    int hot_x, hot_y;
+    bool shown;
+    int x, y;
+} hw_cursor;
+
+static bool hw_cursor_supported = true;
+
 static bool drm_setup(void) {
     drm_fd = open("/dev/dri/card1", O_RDWR | O_CLOEXEC);
     if (drm_fd < 0) { perror("open"); return false; }
@@ -87,32 +148,147 @@ static bool create_dumb_buffer(int idx, uint32_t w, uint32_t h) {
     return true;
 }
 
-bool fb_init() {
+static bool drm_init(void) {
     if (!drm_setup()) return false;
 
-    if (!create_dumb_buffer(0, mode.hdisplay, mode.vdisplay)) return false;
-    if (!create_dumb_buffer(1, mode.hdisplay, mode.vdisplay)) return false;
+    for (int i = 0; i < NUM_BUFFERS; i++)
+        if (!create_dumb_buffer(i, mode.hdisplay, mode.vdisplay)) return false;
 
     if (drmModeSetCrtc(drm_fd, crtc_id, dumb_buf[0].fb_id, 0, 0, &connector_id, 1, &mode)) {
         perror("drmModeSetCrtc");
         return false;
     }
 
-    screen_buffer = malloc(dumb_buf[0].size);
-    if (!screen_buffer) {
-        perror("malloc screen_buffer");
+    for (int i = 0; i < SCANOUT_SLOTS; i++) scanout[i].fd = -1;
+
+    const char *pm = getenv("SQWS_PRESENT");
+    if (pm && !strcmp(pm, "direct")) present_mode = PRESENT_DIRECT;
+
+    if (present_mode == PRESENT_SHADOW) {
+        screen_buffer = surface_alloc(dumb_buf[0].size);
+        if (!screen_buffer) return false;
+    }
+
+    return true;
+}
+
+static void scanout_free(int i) {
+    if (scanout[i].fd < 0) return;
+    drmModeRmFB(drm_fd, scanout[i].fb_id);
+    struct drm_gem_close creq = {.handle = scanout[i].handle};
+    drmIoctl(drm_fd, DRM_IOCTL_GEM_CLOSE, &creq);
+    close(scanout[i].fd);
+    scanout[i].fd = -1;
+}
+
+static void hw_cursor_hide(void) {
+    if (!hw_cursor.shown) return;
+    drmModeSetCursor(drm_fd, crtc_id, 0, 0, 0);
+    hw_cursor.shown = false;
+}
+
+static void hw_cursor_free(void) {
+    hw_cursor_hide();
+    if (hw_cursor.map) munmap(hw_cursor.map, hw_cursor.size);
+    if (hw_cursor.handle) {
+        struct drm_mode_destroy_dumb dreq = {.handle = hw_cursor.handle};
+        drmIoctl(drm_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+    }
+    memset(&hw_cursor, 0, sizeof(hw_cursor));
+}
+
+static void hw_cursor_unsupported(const char *what) {
+    perror(what);
+    fprintf(stderr, "drawing the cursor into fullscreen windows instead of scanning them out\n");
+    hw_cursor_supported = false;
+    hw_cursor_free();
+}
+
+// a dumb buffer of the size the cursor plane takes, 64x64 unless the driver
+// says otherwise
+static bool hw_cursor_create(void) {
+    uint64_t w = 64, h = 64;
+    drmGetCap(drm_fd, DRM_CAP_CURSOR_WIDTH, &w);
+    drmGetCap(drm_fd, DRM_CAP_CURSOR_HEIGHT, &h);
+    struct drm_mode_create_dumb creq = {.width = w, .height = h, .bpp = 32};
+    if (drmIoctl(drm_fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq) < 0) {
+        hw_cursor_unsupported("DRM_IOCTL_MODE_CREATE_DUMB cursor");
         return false;
     }
+    hw_cursor.handle = creq.handle;
+    hw_cursor.width = w;
+    hw_cursor.height = h;
+    hw_cursor.pitch = creq.pitch;
+    hw_cursor.size = creq.size;
 
+    struct drm_mode_map_dumb mreq = {.handle = creq.handle};
+    void *map = MAP_FAILED;
+    if (drmIoctl(drm_fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq) == 0)
+        map = mmap(NULL, creq.size, PROT_READ | PROT_WRITE, MAP_SHARED, drm_fd, mreq.offset);
+    if (map == MAP_FAILED) {
+        hw_cursor_unsupported("mmap cursor");
+        return false;
+    }
+    hw_cursor.map = map;
     return true;
 }
 
-void fb_cleanup() {
-    free_windows();
+// shows the pointer on the cursor plane, or takes it off when there is none.
+// false if it can't go there and has to be drawn into the frame
+static bool hw_cursor_update(void) {
+    int w, h, hx, hy;
+    uint32_t gen;
+    const uint32_t *argb = cursor_sprite(&w, &h, &hx, &hy, &gen);
+    if (!argb) {
+        hw_cursor_hide();
+        return true;
+    }
+    if (!hw_cursor_supported || (!hw_cursor.map && !hw_cursor_create())) return false;
+    if ((uint32_t)w > hw_cursor.width || (uint32_t)h > hw_cursor.height) return false;
 
-    if (screen_buffer) free(screen_buffer);
+    if (hw_cursor.gen != gen) {
+        memset(hw_cursor.map, 0, hw_cursor.size);
+        for (int y = 0; y < h; y++)
+            memcpy((unsigned char *)hw_cursor.map + (size_t)y * hw_cursor.pitch, argb + (size_t)y * w, (size_t)w * 4);
+        hw_cursor.gen = gen;
+        hw_cursor.hot_x = hx;
+        hw_cursor.hot_y = hy;
+        hw_cursor.shown = false;
+    }
+    if (!hw_cursor.shown) {
+        // the hotspot is only a hint for virtual GPUs, older kernels lack it
+        if (drmModeSetCursor2(drm_fd, crtc_id, hw_cursor.handle, hw_cursor.width, hw_cursor.height, hx, hy) &&
+            drmModeSetCursor(drm_fd, crtc_id, hw_cursor.handle, hw_cursor.width, hw_cursor.height)) {
+            hw_cursor_unsupported("drmModeSetCursor");
+            return false;
+        }
+        hw_cursor.shown = true;
+        hw_cursor.x = hw_cursor.y = INT32_MIN;
+    }
+    // the plane is placed by its top left corner
+    int x = mouse_x - hw_cursor.hot_x, y = mouse_y - hw_cursor.hot_y;
+    if (x != hw_cursor.x || y != hw_cursor.y) {
+        drmModeMoveCursor(drm_fd, crtc_id, x, y);
+        hw_cursor.x = x;
+        hw_cursor.y = y;
+    }
+    return true;
+}
+
+static void drm_cleanup(void) {
+    surface_free(screen_buffer, dumb_buf[0].size);
+    screen_buffer = NULL;
 
-    for (int i = 0; i < 2; i++) {
+    hw_cursor_free();
+
+    for (int i = 0; i < SCANOUT_SLOTS; i++) scanout_free(i);
+    if (udmabuf_fd >= 0) {
+        close(udmabuf_fd);
+        udmabuf_fd = -1;
+    }
+
+    for (int i = 0; i < NUM_BUFFERS; i++) {
+        cursor_save_free(&dumb_buf[i].cursor);
         if (dumb_buf[i].map) {
             munmap(dumb_buf[i].map, dumb_buf[i].size);
             dumb_buf[i].map = NULL;
@@ -135,13 +311,239 @@ void fb_cleanup() {
     }
 }
 
-void fb_flush() {
-    int back_buf = 1 - front_buf;
-    memcpy(dumb_buf[back_buf].map, screen_buffer, dumb_buf[back_buf].size);
+static int next_buf(void) {
+    return (front_buf + 1) % NUM_BUFFERS;
+}
 
-    if (drmModeSetCrtc(drm_fd, crtc_id, dumb_buf[back_buf].fb_id, 0, 0, &connector_id, 1, &mode)) {
-        perror("drmModeSetCrtc swap");
+// everything that changed since the buffer was last shown
+static void buffer_region(int idx, const damage_t *damage, damage_t *out) {
+    int age = dumb_buf[idx].age;
+    damage_clear(out);
+    if (age == 0 || age > NUM_BUFFERS) {
+        damage_add(out, 0, 0, mode.hdisplay, mode.vdisplay);
+        return;
+    }
+    for (int i = 0; i < damage->count; i++)
+        damage_add_rect(out, &damage->rects[i]);
+    for (int a = 0; a < age - 1; a++)
+        for (int i = 0; i < damage_history[a].count; i++)
+            damage_add_rect(out, &damage_history[a].rects[i]);
+}
+
+static unsigned char *drm_begin_frame(const damage_t *damage, damage_t *repaint, int *pitch) {
+    int back_buf = next_buf();
+    frame_kind = FRAME_COMPOSED;
+    frame_damage = *damage;
+    buffer_region(back_buf, damage, &frame_region);
+    *pitch = dumb_buf[back_buf].pitch;
+    // the cursor isn't in screen_buffer, only in the dumb buffers
+    damage_clear(&cursor_region);
+    cursor_erase(&dumb_buf[back_buf].cursor, dumb_buf[back_buf].map, *pitch, &frame_region, &cursor_region);
+
+    if (present_mode == PRESENT_DIRECT) {
+        *repaint = frame_region;
+        return dumb_buf[back_buf].map;
+    }
+    *repaint = *damage;
+    return screen_buffer;
+}
+
+static void scanout_unsupported(const char *what) {
+    perror(what);
+    fprintf(stderr, "copying fullscreen windows instead of scanning them out\n");
+    scanout_supported = false;
+}
+
+// a framebuffer showing the canvas of w straight from its memfd, -1 if there
+// can't be one
+static int scanout_import(const window_t *w) {
+    size_t size = (size_t)w->canvas_w * w->canvas_h * 4;
+    size_t offset = w->canvas - w->shm_map;
+    struct stat st;
+    if (!scanout_supported || w->shm_fd < 0 || size % 4096 || fstat(w->shm_fd, &st) < 0) return -1;
+
+    int free_slot = -1;
+    for (int i = 0; i < SCANOUT_SLOTS; i++) {
+        if (scanout[i].fd < 0) {
+            if (free_slot < 0) free_slot = i;
+        } else if (scanout[i].dev == st.st_dev && scanout[i].ino == st.st_ino && scanout[i].offset == offset) {
+            return i;
+        }
+    }
+    // only the last two frames hold on to theirs, so this hardly happens
+    if (free_slot < 0) return -1;
+
+    if (udmabuf_fd < 0) {
+        udmabuf_fd = open("/dev/udmabuf", O_RDWR | O_CLOEXEC);
+        if (udmabuf_fd < 0) {
+            scanout_unsupported("open /dev/udmabuf");
+            return -1;
+        }
+    }
+    struct udmabuf_create creq = {
+        .memfd = w->shm_fd, .flags = UDMABUF_FLAGS_CLOEXEC, .offset = offset, .size = size,
+    };
+    int dmabuf = ioctl(udmabuf_fd, UDMABUF_CREATE, &creq);
+    if (dmabuf < 0) {
+        scanout_unsupported("UDMABUF_CREATE");
+        return -1;
+    }
+    uint32_t handle, fb_id;
+    int ret = drmPrimeFDToHandle(drm_fd, dmabuf, &handle);
+    close(dmabuf);
+    if (ret) {
+        scanout_unsupported("drmPrimeFDToHandle");
+        return -1;
+    }
+    if (drmModeAddFB(drm_fd, w->canvas_w, w->canvas_h, 24, 32, w->canvas_w * 4, handle, &fb_id)) {
+        scanout_unsupported("drmModeAddFB canvas");
+        struct drm_gem_close gclose = {.handle = handle};
+        drmIoctl(drm_fd, DRM_IOCTL_GEM_CLOSE, &gclose);
+        return -1;
+    }
+    int keep = fcntl(w->shm_fd, F_DUPFD_CLOEXEC, 0);
+    if (keep < 0) {
+        drmModeRmFB(drm_fd, fb_id);
+        struct drm_gem_close gclose = {.handle = handle};
+        drmIoctl(drm_fd, DRM_IOCTL_GEM_CLOSE, &gclose);
+        return -1;
+    }
+    scanout[free_slot].fd = keep;
+    scanout[free_slot].dev = st.st_dev;
+    scanout[free_slot].ino = st.st_ino;
+    scanout[free_slot].offset = offset;
+    scanout[free_slot].handle = handle;
+    scanout[free_slot].fb_id = fb_id;
+    scanout[free_slot].frame = present_count;
+    return free_slot;
+}
+
+static void copy_region(unsigned char *dst, const unsigned char *src, int pitch, const damage_t *region) {
+    for (int i = 0; i < region->count; i++) {
+        const rect_t *r = &region->rects[i];
+        size_t off = (size_t)r->y0 * pitch + r->x0 * 4;
+        size_t len = (r->x1 - r->x0) * 4;
+        for (int y = r->y0; y < r->y1; y++, off += pitch)
+            memcpy(dst + off, src + off, len);
+    }
+}
+
+static void report_dirty(uint32_t fb_id, const damage_t *region) {
+    if (!dirtyfb_supported) return;
+
+    struct drm_clip_rect clips[MAX_DAMAGE_RECTS];
+    for (int i = 0; i < region->count; i++) {
+        clips[i].x1 = region->rects[i].x0;
+        clips[i].y1 = region->rects[i].y0;
+        clips[i].x2 = region->rects[i].x1;
+        clips[i].y2 = region->rects[i].y1;
+    }
+    // most drivers scan out straight from memory and don't implement it
+    if (drmModeDirtyFB(drm_fd, fb_id, clips, region->count) == -ENOSYS)
+        dirtyfb_supported = false;
+}
+
+static void page_flip_handler(int fd, unsigned int seq, unsigned int sec, unsigned int usec, void *data) {
+    sched_frame_done(data, (uint64_t)sec * 1000000000ull + (uint64_t)usec * 1000);
+}
+
+static bool drm_bypass(const window_t *w, const damage_t *damage, bool *zero_copy) {
+    frame_damage = *damage;
+    // the pointer, if any, goes on the cursor plane as the canvas can't have it
+    scanout_slot = w->shm_map ? scanout_import(w) : -1;
+    if (scanout_slot >= 0 && hw_cursor_update()) {
+        frame_kind = FRAME_SCANOUT;
+        *zero_copy = true;
+        return true;
+    }
+
+    int back_buf = next_buf();
+    int pitch = dumb_buf[back_buf].pitch;
+    frame_kind = FRAME_COPIED;
+    buffer_region(back_buf, damage, &frame_region);
+    damage_clear(&cursor_region);
+    cursor_erase(&dumb_buf[back_buf].cursor, dumb_buf[back_buf].map, pitch, &frame_region, &cursor_region);
+    fb_copy_canvas(dumb_buf[back_buf].map, pitch, w, &frame_region);
+    return true;
+}
+
+static bool drm_present(void *ctx, frame_sched_t *sched) {
+    int back_buf = next_buf();
+    uint32_t fb_id = dumb_buf[back_buf].fb_id;
+    if (frame_kind == FRAME_SCANOUT) {
+        fb_id = scanout[scanout_slot].fb_id;
     } else {
+        // back to the one drawn in by cursor.c
+        hw_cursor_hide();
+        if (frame_kind == FRAME_COMPOSED && present_mode == PRESENT_SHADOW)
+            copy_region(dumb_buf[back_buf].map, screen_buffer, dumb_buf[back_buf].pitch, &frame_region);
+        cursor_draw(&dumb_buf[back_buf].cursor, dumb_buf[back_buf].map, dumb_buf[back_buf].pitch, &cursor_region);
+    }
+
+    if (drmModePageFlip(drm_fd, crtc_id, fb_id, DRM_MODE_PAGE_FLIP_EVENT, sched)) {
+        // no async flips on this driver, fall back to a blocking modeset
+        if (drmModeSetCrtc(drm_fd, crtc_id, fb_id, 0, 0, &connector_id, 1, &mode)) {
+            perror("drmModeSetCrtc swap");
+            return false;
+        }
+        sched_frame_done(sched, clock_now_ns());
+    }
+    present_count++;
+
+    // the dumb buffers keep aging through scanned out frames, nothing was
+    // drawn into them
+    for (int i = 0; i < NUM_BUFFERS; i++)
+        if (dumb_buf[i].age) dumb_buf[i].age++;
+    if (frame_kind == FRAME_SCANOUT) {
+        scanout[scanout_slot].frame = present_count;
+    } else {
+        damage_t dirty = frame_region;
+        for (int i = 0; i < cursor_region.count; i++)
+            damage_add_rect(&dirty, &cursor_region.rects[i]);
+        report_dirty(fb_id, &dirty);
         front_buf = back_buf;
+        dumb_buf[back_buf].age = 1;
     }
-}
\ No newline at end of file
+    // a framebuffer is off screen once the frame after the one showing it is
+    // done, which it is by the time the one after that is presented
+    for (int i = 0; i < SCANOUT_SLOTS; i++)
+        if (scanout[i].fd >= 0 && scanout[i].frame + 2 <= present_count) scanout_free(i);
+
+    memmove(&damage_history[1], &damage_history[0], (NUM_BUFFERS - 1) * sizeof(damage_t));
+    damage_history[0] = frame_damage;
+    return true;
+}
+
+static uint64_t drm_now(void *ctx) {
+    return clock_now_ns();
+}
+
+static int drm_event_fd(void *ctx) {
+    return drm_fd;
+}
+
+static void drm_dispatch(void *ctx) {
+    drmEventContext evctx = {
+        .version = DRM_EVENT_CONTEXT_VERSION,
+        .page_flip_handler = page_flip_handler,
+    };
+    drmHandleEvent(drm_fd, &evctx);
+}
+
+static const presenter_t drm_presenter = {
+    .now = drm_now,
+    .present = drm_present,
+    .event_fd = drm_event_fd,
+    .dispatch = drm_dispatch,
+};
+
+const output_backend_t drm_backend = {
+    .name = "drm",
+    .init = drm_init,
+    .cleanup = drm_cleanup,
+    .begin_frame = drm_begin_frame,
+    .presenter = &drm_presenter,
+    .bypass = drm_bypass,
+    .mouse_dev = "/dev/input/mice",
+    .keyboard_dev = "/dev/input/by-id/*-event-kbd",
+};
@@ -1,4 +1,8 @@
+#define _GNU_SOURCE
 #include "wm.h"
+#include "draw.h"
+#include "fonts.h"
+#include "sqwsproto.h"
 
 #include <fcntl.h>
 #include <stdio.h>
@@ -8,7 +12,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <linux/kd.h>
@@ -23,8 +28,6 @@
 pid_t client_pid = -1;
 #endif
 
-struct pollfd *fds = NULL;
-
 int ev_fd = -1;
 struct termios orig_termios;
 int old_kd_mode = -1;
@@ -37,247 +40,144 @@ void handle_sigint(int signo) {
     stop_flag = 1;
 }
 
-void clients_init(client_array_t *clients) {
-    clients->fds = NULL;
-    clients->size = 0;
-    clients->capacity = 0;
+static client_array_t clients;
+static frame_sched_t sched;
+
+static loop_source_t listen_source, present_source, timer_source;
+static int frame_timer_fd = -1;
+static uint64_t frame_timer_deadline = SCHED_NEVER;
+
+static void client_ready(loop_source_t *src, uint32_t events) {
+    client_t *c = src->data;
+    bool ok = !c->overflowed;
+    if (ok && (events & EPOLLOUT)) ok = client_flush(c);
+    // gone while waiting for a commit reply, see client_t.release_buffer
+    if (ok && c->release_buffer >= 0 && (events & (EPOLLHUP | EPOLLERR))) ok = false;
+    if (ok && ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) || c->pending)) ok = client_read(c);
+    if (ok) ok = loop_modify(src, (c->release_buffer >= 0 ? 0 : EPOLLIN) | (c->tx_len ? EPOLLOUT : 0));
+    if (!ok) {
+        printf("client disconnected, closing its windows\n");
+        clients_remove(&clients, c);
+        return;
+    }
+    // out of budget, go on right after this round
+    if (c->pending) loop_defer(src);
 }
 
-void clients_free(client_array_t *clients) {
-    for (size_t i = 0; i < clients->size; i++) {
-        if (clients->fds[i] >= 0) close(clients->fds[i]);
+static void accept_ready(loop_source_t *src, uint32_t events) {
+    int new_fd;
+    while ((new_fd = accept4(src->fd, NULL, NULL, SOCK_CLOEXEC)) >= 0) {
+        printf("Client connected\n");
+        client_t *c = clients_add(&clients, new_fd);
+        if (!c) {
+            fprintf(stderr, "failed to add client, closing socket\n");
+            close(new_fd);
+        } else if (!loop_add(&c->source, new_fd, EPOLLIN, client_ready, c)) {
+            clients_remove(&clients, c);
+        }
     }
-    free(clients->fds);
-    clients->fds = NULL;
-    clients->size = 0;
-    clients->capacity = 0;
 }
 
-bool clients_add(client_array_t *clients, int fd) {
-    if (clients->size == clients->capacity) {
-        size_t new_capacity = clients->capacity ? clients->capacity * 2 : 4;
-        int *new_fds = realloc(clients->fds, new_capacity * sizeof(int));
-        if (!new_fds) return false;
-        clients->fds = new_fds;
-        clients->capacity = new_capacity;
+static void present_ready(loop_source_t *src, uint32_t events) {
+    sched.presenter->dispatch(sched.presenter->ctx);
+    clients_frame_done(&clients);
+}
+
+uint64_t frames_presented(void) {
+    return sched.frames_presented;
+}
+
+uint64_t frames_done(void) {
+    return sched.frames_done;
+}
+
+// a window covering the whole output is shown without composing anything.
+// the buffers composed into fall behind meanwhile, so the first frame after
+// that is composed whole
+static bool bypassed = false;
+
+static void render_frame(void) {
+    int slot = window_covering_output();
+    bool zero_copy = false;
+    if (slot >= 0 && fb_bypass(&windows[slot], &screen_damage, &zero_copy)) {
+        if (zero_copy) windows[slot].scanout_frame = sched.frames_presented + 1;
+        bypassed = true;
+        return;
     }
-    clients->fds[clients->size++] = fd;
-    return true;
+    if (bypassed) damage_all();
+    bypassed = false;
+
+    damage_t repaint;
+    int pitch;
+    unsigned char *buf = fb_begin_frame(&screen_damage, &repaint, &pitch);
+    redraw_damage(buf, pitch, mode.hdisplay, mode.vdisplay, &repaint);
 }
 
-void clients_remove(client_array_t *clients, size_t index) {
-    if (index >= clients->size) return;
-    close(clients->fds[index]);
-    memmove(&clients->fds[index], &clients->fds[index+1], (clients->size - index - 1) * sizeof(int));
-    clients->size--;
+// the frame timer only wakes the loop up, repaints happen at the top of it
+static void timer_ready(loop_source_t *src, uint32_t events) {
+    uint64_t expirations;
+    if (read(frame_timer_fd, &expirations, sizeof(expirations)) < 0) return;
+    frame_timer_deadline = SCHED_NEVER;
 }
 
-int get_focused_window_idx(void) {
-    for (int i = 0; i < MAX_WINDOWS; i++) {
-        if (windows[i].used && windows[i].focused)
-            return i;
+static void arm_frame_timer(uint64_t deadline) {
+    if (deadline == frame_timer_deadline) return;
+    // a zero it_value disarms, so a deadline of 0 has to be nudged
+    struct itimerspec its = {0};
+    if (deadline != SCHED_NEVER) {
+        its.it_value.tv_sec = deadline / 1000000000ull;
+        its.it_value.tv_nsec = deadline % 1000000000ull;
+        if (!deadline) its.it_value.tv_nsec = 1;
     }
-    return -1;
+    if (timerfd_settime(frame_timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+        perror("timerfd_settime");
+        return;
+    }
+    frame_timer_deadline = deadline;
 }
 
 void event_loop(int server_fd) {
-    client_array_t clients;
     clients_init(&clients);
 
-    size_t fds_capacity = 0;
+    sched_init(&sched, output->presenter, mode_refresh_ns(&mode));
+    const presenter_t *presenter = sched.presenter;
 
-    int drag_window = -1, drag_dx = 0, drag_dy = 0;
+    frame_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (frame_timer_fd < 0) {
+        perror("timerfd_create");
+        return;
+    }
 
-    while (!stop_flag) {
-        size_t needed = clients.size + 2;
-        if (fds_capacity < needed) {
-            size_t new_capacity = fds_capacity ? fds_capacity * 2 : 8;
-            while (new_capacity < needed) new_capacity *= 2;
-            struct pollfd *new_fds = realloc(fds, new_capacity * sizeof(struct pollfd));
-            if (!new_fds) {
-                perror("realloc");
-                break;
-            }
-            fds = new_fds;
-            fds_capacity = new_capacity;
-        }
+    if (!loop_add(&listen_source, server_fd, EPOLLIN, accept_ready, NULL) ||
+        !loop_add(&timer_source, frame_timer_fd, EPOLLIN, timer_ready, NULL) ||
+        !loop_add(&present_source, presenter->event_fd(presenter->ctx), EPOLLIN, present_ready, NULL))
+        stop_flag = 1;
 
-        fds[0].fd = server_fd;
-        fds[0].events = POLLIN;
+    damage_all();
 
-        for (size_t i = 0; i < clients.size; i++) {
-            fds[i+1].fd = clients.fds[i];
-            fds[i+1].events = POLLIN;
+    while (!stop_flag) {
+        if (sched_repaint_due(&sched, screen_damage.count != 0 || mouse_motion_pending())) {
+            mouse_flush_motion();
+            render_frame();
+            if (sched_present(&sched))
+                damage_clear(&screen_damage);
+            // done already if the presenter completed it synchronously
+            clients_frame_done(&clients);
         }
 
-        fds[clients.size + 1].fd = ev_fd;
-        fds[clients.size + 1].events = POLLIN;
-
-        int timeout = 10;
-        int ret = poll(fds, needed, timeout);
-        if (ret < 0) break;
-
-        if (fds[0].revents & POLLIN) {
-            int new_fd = accept(server_fd, NULL, NULL);
-            if (new_fd >= 0) {
-                printf("Client connected\n");
-                free_windows();
-                if (!clients_add(&clients, new_fd)) {
-                    fprintf(stderr, "failed to add client, closing socket\n");
-                    close(new_fd);
-                }
-            }
+        arm_frame_timer(sched_deadline(&sched, screen_damage.count != 0 || mouse_motion_pending()));
+        if (loop_dispatch(-1) < 0) {
+            perror("epoll_wait");
+            break;
         }
-        
-        for (size_t i = 0; i < clients.size; ) {
-            int cfd = clients.fds[i];
-            if (fds[i+1].revents & POLLIN) {
-                unsigned char cmd;
-                ssize_t r = read(cfd, &cmd, 1);
-                if (r <= 0) {
-                    printf("client disconnected, closing all windows\n");
-                    clients_remove(&clients, i);
-                    free_windows();
-                    continue;
-                } else {
-                    switch (cmd) {
-                        case 0x01: {
-                            unsigned char buf[1+64+4*4+4];
-                            ssize_t total = 0;
-                            while (total < (ssize_t)sizeof(buf)) {
-                                ssize_t rr = read(cfd, buf + total, sizeof(buf) - total);
-                                if (rr <= 0) {
-                                    clients_remove(&clients, i);
-                                    free_windows();
-                                    goto next_client;
-                                }
-                                total += rr;
-                            }
-                            int idx = buf[0];
-                            char title[65];
-                            memcpy(title, &buf[1], 64);
-                            title[64] = '\0';
-                            int x = *(int *)(buf+65);
-                            int y = *(int *)(buf+69);
-                            int w = *(int *)(buf+73);
-                            int h = *(int *)(buf+77);
-                            unsigned char color[4];
-                            memcpy(color, buf+81, 4);
-                            handle_create(idx, title, x, y, w, h, color);
-                            break;
-                        }
-                        case 0x02: {
-                            unsigned char idx;
-                            if (read(cfd, &idx, 1) == 1) {
-                                handle_destroy(idx);
-                            }
-                            break;
-                        }
-                        case 0x03: {
-                            unsigned char buf[1+4+4];
-                            ssize_t total = 0;
-                            while (total < (ssize_t)sizeof(buf)) {
-                                ssize_t rr = read(cfd, buf + total, sizeof(buf) - total);
-                                if (rr <= 0) {
-                                    clients_remove(&clients, i);
-                                    free_windows();
-                                    goto next_client;
-                                }
-                                total += rr;
-                            }
-                            int idx = buf[0];
-                            int x = *(int *)(buf+1);
-                            int y = *(int *)(buf+5);
-                            if (idx >= 0 && idx < MAX_WINDOWS && windows[idx].used) {
-                                windows[idx].x = x;
-                                windows[idx].y = y;
-                            }
-                            break;
-                        }
-                        case 0x04: {
-                            unsigned char idx;
-                            if (read(cfd, &idx, 1) == 1 && idx < MAX_WINDOWS && windows[idx].used) {
-                                window_t *win = &windows[idx];
-                                size_t canvas_size = win->canvas_w * win->canvas_h * 4;
-                                ssize_t total = 0;
-                                while (total < (ssize_t)canvas_size) {
-                                    ssize_t r = read(cfd, win->canvas + total, canvas_size - total);
-                                    if (r <= 0) {
-                                        clients_remove(&clients, i);
-                                        free_windows();
-                                        goto next_client;
-                                    }
-                                    total += r;
-                                }
-                            }
-                            break;
-                        }
-                        case 0x10: {
-                            unsigned char idx;
-                            if (read(cfd, &idx, 1) == 1 && idx < MAX_WINDOWS && windows[idx].used) {
-                                write(cfd, &windows[idx], sizeof(window_t));
-                            }
-                            break;
-                        }
-                        case 0x11: {
-                            unsigned char idx;
-                            ssize_t rr = read(cfd, &idx, 1);
-                            if (rr != 1) {
-                                fprintf(stderr, "failed to read idx for get_key\n");
-                                clients_remove(&clients, i);
-                                free_windows();
-                                break;
-                            }
-                            unsigned char key = 0;
-                            int fidx = get_focused_window_idx();
-                            if (fidx == idx) {
-                                for (int k = 1; k < MAX_VK_CODE; k++) {
-                                    if (keys_pressed[k]) {
-                                        key = (unsigned char)k;
-                                        break;
-                                    }
-                                }
-                            }
-                            ssize_t ww = write(cfd, &key, sizeof(key));
-                            if (ww != sizeof(key)) {
-                                fprintf(stderr, "failed to write key response\n");
-                                clients_remove(&clients, i);
-                                free_windows();
-                            }
-                            break;
-                        }
-                        case 0x12: {
-                            unsigned char idx;
-                            if (read(cfd, &idx, 1) == 1) {
-                                int pos[2] = {0, 0};
-                                int fidx = get_focused_window_idx();
-                                if (fidx == idx) {
-                                    pos[0] = mouse_x;
-                                    pos[1] = mouse_y;
-                                }
-                                write(cfd, pos, sizeof(pos));
-                            }
-                            break;
-                        }
-                        default:
-                            break;
-                    }
-                }
-            }
-            i++;
-            next_client:;
-        }
-
-        keyboard_process(&clients);
-        mouse_process(&drag_window, &drag_dx, &drag_dy);
-
-        redraw_all(screen_buffer, mode.hdisplay * 4, mode.hdisplay, mode.vdisplay);
-        draw_cursor(screen_buffer, mode.hdisplay * 4, mode.hdisplay, mode.vdisplay, mouse_x, mouse_y);
-        fb_flush();
     }
 
+    loop_remove(&listen_source);
+    loop_remove(&timer_source);
+    loop_remove(&present_source);
     clients_free(&clients);
-    free(fds);
+    close(frame_timer_fd);
+    frame_timer_fd = -1;
 }
 
 void cleanup(void) {
@@ -289,6 +189,10 @@ void cleanup(void) {
 
     fb_cleanup();
     mouse_cleanup();
+    loop_cleanup();
+    compose_cleanup();
+    cursor_cleanup();
+    font_cleanup();
 }
 
 int main(void) {
@@ -296,8 +200,12 @@ int main(void) {
     signal(SIGTERM, handle_sigint);
     atexit(cleanup);
 
-    memset(keys_pressed, 0, sizeof(keys_pressed));
+    blend_init();
+    if (!font_init()) return 1;
+    if (!compose_init()) return 1;
+    if (!cursor_init()) return 1;
 
+    if (!loop_init()) return 1;
     if (!fb_init()) return 1;
     if (!mouse_init()) {
         fprintf(stderr, "no mouse\n");
@@ -305,10 +213,7 @@ int main(void) {
 
     keyboard_init();
 
-    memset(windows, 0, sizeof(windows));
-    for (int i = 0; i < MAX_WINDOWS; i++) windows[i].focused = false;
-
-    int server_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    int server_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (server_fd < 0) {
         perror("socket");
         return 1;
@@ -0,0 +1,75 @@
+#define _GNU_SOURCE
+#include "wm.h"
+#include "sqwsproto.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// after an acked configure the new canvas is kept aside until its first
+// commit, the old one keeps showing meanwhile. a canvas of any other size is
+// from a client that hasn't caught up with the last configure yet, it is
+// refused and what is shown stays
+bool shm_attach(window_t *w, int fd, int cw, int ch) {
+    int want_w = w->configure_acked ? w->configure_w : w->canvas_w;
+    int want_h = w->configure_acked ? w->configure_h : w->canvas_h;
+    if (cw != want_w || ch != want_h) return false;
+    size_t canvas_size = (size_t)cw * ch * 4;
+    size_t size = canvas_size * SQWS_SHM_BUFFERS;
+
+    // a client shrinking the file under us would SIGBUS the server
+    int seals = fcntl(fd, F_GET_SEALS);
+    if (seals < 0 || !(seals & F_SEAL_SHRINK)) {
+        fprintf(stderr, "shm canvas is not sealed against shrinking\n");
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < size) {
+        fprintf(stderr, "shm canvas too small\n");
+        return false;
+    }
+
+    unsigned char *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        perror("mmap shm canvas");
+        return false;
+    }
+    // kept for scanning the canvas out as it is, which can do without
+    int keep = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+
+    if (w->configure_acked) {
+        window_drop_next(w);
+        w->next_shm_map = map;
+        w->next_shm_size = size;
+        w->next_shm_fd = keep;
+        return true;
+    }
+
+    window_free_canvas(w);
+    w->shm_map = map;
+    w->shm_size = size;
+    w->shm_fd = keep;
+    w->shm_front = 0;
+    w->canvas = map;
+    damage_window(w);
+    return true;
+}
+
+int shm_commit(window_t *w, int buffer) {
+    if (buffer < 0 || buffer >= SQWS_SHM_BUFFERS) return -1;
+    if (w->next_shm_map) window_adopt_next(w);
+    if (!w->shm_map) return -1;
+
+    int released = w->shm_front;
+    size_t canvas_size = w->shm_size / SQWS_SHM_BUFFERS;
+    w->shm_front = buffer;
+    w->canvas = w->shm_map + canvas_size * buffer;
+    w->drawn = true;
+    damage_window(w);
+    return released;
+}
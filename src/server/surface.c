@@ -0,0 +1,94 @@
+#define _GNU_SOURCE
+#include "wm.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+// pixel buffers for canvases and compose targets. they come straight from
+// mmap, so they are page aligned and read as zero without being cleared: a
+// page only gets memory, already zeroed, once it is touched
+//
+// sizes are rounded up to one of four classes per power of two and freed
+// buffers are kept per class for the next window of about the same size,
+// which saves the mmap/munmap pair and keeps the address space from
+// fragmenting when windows come and go. their pages are handed back to the
+// kernel on the way into the pool, so a recycled buffer is zero again and
+// only costs memory once it is drawn into
+//
+// buffers of a huge page or more are aligned to it and marked for
+// transparent huge pages, which cuts the page faults of filling a large
+// canvas by the number of pages in a huge page
+
+#define SURFACE_PAGE 4096
+#define SURFACE_HUGE (2u << 20)
+#define SURFACE_CLASSES 64
+// buffers kept per class
+#define SURFACE_POOL_DEPTH 4
+
+static void *pool[SURFACE_CLASSES][SURFACE_POOL_DEPTH];
+static int pool_count[SURFACE_CLASSES];
+static size_t pool_bytes[SURFACE_CLASSES];
+
+// the class of a size and the bytes buffers of that class have, -1 for
+// sizes too large to be pooled
+static int size_class(size_t size, size_t *bytes) {
+    size_t pages = (size + SURFACE_PAGE - 1) / SURFACE_PAGE;
+    if (!pages) pages = 1;
+    int cls;
+    if (pages <= 4) {
+        cls = pages - 1;
+    } else {
+        int lg = 63 - __builtin_clzll(pages - 1);
+        size_t step = (size_t)1 << (lg - 2);
+        pages = (pages + step - 1) & ~(step - 1);
+        cls = 4 + (lg - 2) * 4 + (int)((pages >> (lg - 2)) - 4) - 1;
+    }
+    *bytes = pages * SURFACE_PAGE;
+    if (*bytes >= SURFACE_HUGE) *bytes = (*bytes + SURFACE_HUGE - 1) & ~(size_t)(SURFACE_HUGE - 1);
+    return cls < SURFACE_CLASSES ? cls : -1;
+}
+
+static void *map_surface(size_t bytes) {
+    if (bytes < SURFACE_HUGE) {
+        void *p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return p == MAP_FAILED ? NULL : p;
+    }
+    // map a huge page more than needed and cut it down to an aligned range
+    size_t len = bytes + SURFACE_HUGE;
+    unsigned char *raw = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+    unsigned char *p = (unsigned char *)(((uintptr_t)raw + SURFACE_HUGE - 1) & ~(uintptr_t)(SURFACE_HUGE - 1));
+    if (p > raw) munmap(raw, p - raw);
+    if (raw + len > p + bytes) munmap(p + bytes, raw + len - (p + bytes));
+    madvise(p, bytes, MADV_HUGEPAGE);
+    return p;
+}
+
+void *surface_alloc(size_t size) {
+    size_t bytes;
+    int cls = size_class(size, &bytes);
+    if (cls >= 0 && pool_count[cls]) return pool[cls][--pool_count[cls]];
+    void *p = map_surface(bytes);
+    if (!p) perror("mmap surface");
+    return p;
+}
+
+void surface_free(void *p, size_t size) {
+    if (!p) return;
+    size_t bytes;
+    int cls = size_class(size, &bytes);
+    if (cls >= 0 && pool_count[cls] < SURFACE_POOL_DEPTH && !madvise(p, bytes, MADV_DONTNEED)) {
+        pool[cls][pool_count[cls]++] = p;
+        pool_bytes[cls] = bytes;
+        return;
+    }
+    munmap(p, bytes);
+}
+
+void surface_cleanup(void) {
+    for (int cls = 0; cls < SURFACE_CLASSES; cls++) {
+        for (int i = 0; i < pool_count[cls]; i++) munmap(pool[cls][i], pool_bytes[cls]);
+        pool_count[cls] = 0;
+    }
+}
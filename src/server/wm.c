@@ -12,88 +12,46 @@
 #include <linux/input.h>
 
 #include "wm.h"
+#include "draw.h"
 #include "fonts.h"
+#include "sqwsproto.h"
 
-window_t windows[MAX_WINDOWS];
+window_t *windows = NULL;
+int window_slots = 0, window_count = 0;
+window_geom_t window_geom;
+
+// stacking order as a list of used slots linked both ways, so raising or
+// lowering a window doesn't move anything. unused slots are chained through
+// z_above instead, lowest first
+static int *z_above, *z_below;
+static int z_top = -1, z_bottom = -1, free_slots = -1;
+// the next ranks for window_geom.z on top and at the bottom
+static int64_t z_next_top = 1, z_next_bottom = 0;
+static int focused_slot = -1;
 
 #define BTN_SIZE 16
 #define BTN_SPACING 4
 
-#define TITLEBAR_HEIGHT 20
-#define BORDER 3
-
-static inline void put_pixel(unsigned char *buf, int x, int y, const unsigned char *color, int pitch, int sw, int sh) {
-    uint32_t mask = (unsigned)(x | (sw - 1 - x) | y | (sh - 1 - y)) >> 31;
-    if (!mask) {
-        *(uint32_t *)(buf + y * pitch + x * 4) = *(const uint32_t *)color;
-    }
-}
-
-void draw_char(unsigned char *buf, int x, int y, char ch, const unsigned char *color, int pitch, int sw, int sh) {
-    if (x >= sw || y >= sh) return;
-    if (x + 8 <= 0 || y + 16 <= 0) return;
-
-    const unsigned char *glyph = font8x16_basic[(unsigned char)ch];
-    for (int row = 0; row < 16; row++) {
-        int py = y + row;
-        if (py < 0) continue;
-        if (py >= sh) break;
-
-        unsigned char bits = glyph[row];
-        for (int col = 0; col < 8; col++) {
-            int px = x + col;
-            if (px < 0) continue;
-            if (px >= sw) break;
-
-            if (bits & (1 << (7 - col))) {
-                put_pixel(buf, px, py, color, pitch, sw, sh);
-            }
-        }
-    }
-}
-
-void draw_text(unsigned char *buf, int x, int y, const char *text, const unsigned char *color, int pitch, int sw, int sh) {
-    while (*text) {
-        draw_char(buf, x, y, *text, color, pitch, sw, sh);
-        x += 8;
-        text++;
-    }
-}
-
-//=======================================================================
-
-static inline void blend_pixel(unsigned char *dst, const unsigned char *src) {
-    unsigned a = src[3];
-    if (a == 255) {
-        *(uint32_t *)dst = *(const uint32_t *)src;
-    } else if (a) {
-        for (int i = 0; i < 3; i++)
-            dst[i] = (src[i] * a + dst[i] * (255 - a)) / 255;
-        dst[3] = 255;
-    }
-}
-
 void draw_rect(unsigned char *buf, int x, int y, int w, int h,
                const unsigned char *color, bool alpha, int pitch, int sw, int sh) {
     int start_y = y < 0 ? 0 : y;
     int end_y = y + h > sh ? sh : y + h;
+    int start_x = x < 0 ? 0 : x;
+    int end_x = x + w > sw ? sw : x + w;
+    if (end_x <= start_x) return;
 
     for (int py = start_y; py < end_y; py++) {
-        int start_x = x < 0 ? 0 : x;
-        int end_x = x + w > sw ? sw : x + w;
-
-        for (int px = start_x; px < end_x; px++) {
-            if (alpha) blend_pixel(buf + py * pitch + px * 4, color);
-            else put_pixel(buf, px, py, color, pitch, sw, sh);
-        }
+        uint32_t *row = (uint32_t *)(buf + py * pitch) + start_x;
+        if (alpha) blend_span_solid(row, end_x - start_x, color);
+        else fill_span(row, end_x - start_x, *(const uint32_t *)color);
     }
 }
 
 void draw_button(unsigned char *buf, int x, int y, int w, int h, const unsigned char *color, const char *label, int pitch, int sw, int sh) {
     draw_rect(buf, x, y, w, h, color, 1, pitch, sw, sh);
     unsigned char text_color[4] = {255, 255, 255, 255};
-    int tx = x + (w - 8 * (int)strlen(label)) / 2;
-    int ty = y + (h - 16) / 2;
+    int tx = x + (w - text_width(label)) / 2;
+    int ty = y + (h - font.height) / 2;
     draw_text(buf, tx, ty, label, text_color, pitch, sw, sh);
 }
 
@@ -109,105 +67,545 @@ static void draw_window_buttons(unsigned char *buf, int btn_x, int btn_y, int pi
     draw_button(buf, btn_x, btn_y, BTN_SIZE, BTN_SIZE, fs_color, fullscreen ? "<-" : "[]", pitch, sw, sh);
 }
 
-void draw_window(window_t *w, unsigned char *buf, int pitch, int sw, int sh) {
-    if (!w->used) return;
+// the top border, the side borders next to it and the title bar with its
+// text and buttons only change with focus, title, width or maximize. they are
+// rendered once into a strip and turned into a list of spans per row: solid
+// fills for the borders, one blend for the translucent bar and copies of the
+// opaque text and button pixels from the strip, drawn in that order
+#define DECO_HEIGHT (BORDER + TITLEBAR_HEIGHT)
+
+enum { SPAN_FILL, SPAN_BLEND, SPAN_COPY };
+
+typedef struct {
+    uint32_t color;
+    int x, n;
+    uint8_t kind;
+} deco_span_t;
+
+typedef struct {
+    uint32_t *pixels;
+    deco_span_t *spans;
+    int row_start[DECO_HEIGHT + 1];
+    int span_cap;
+    int w;
+    bool valid;
+} deco_cache_t;
+
+static deco_cache_t *deco_cache;
+
+static const unsigned char border_color[4] = {40,40,40,255};
+
+static bool grow_array(void *arr, size_t elem, int old, int cap) {
+    void **p = arr;
+    unsigned char *items = realloc(*p, cap * elem);
+    if (!items) return false;
+    memset(items + old * elem, 0, (cap - old) * elem);
+    *p = items;
+    return true;
+}
+
+// doubles every per-slot array. the ones grown before a failure just stay
+// larger than window_slots
+static bool grow_windows(void) {
+    int old = window_slots, cap = old ? old * 2 : 64;
+    if (!grow_array(&windows, sizeof(*windows), old, cap) ||
+        !grow_array(&deco_cache, sizeof(*deco_cache), old, cap) ||
+        !grow_array(&window_geom.x, sizeof(int), old, cap) ||
+        !grow_array(&window_geom.y, sizeof(int), old, cap) ||
+        !grow_array(&window_geom.w, sizeof(int), old, cap) ||
+        !grow_array(&window_geom.h, sizeof(int), old, cap) ||
+        !grow_array(&window_geom.flags, sizeof(uint8_t), old, cap) ||
+        !grow_array(&window_geom.z, sizeof(int64_t), old, cap) ||
+        !grow_array(&z_above, sizeof(int), old, cap) ||
+        !grow_array(&z_below, sizeof(int), old, cap)) {
+        fprintf(stderr, "out of memory for windows\n");
+        return false;
+    }
+    for (int i = cap - 1; i >= old; i--) {
+        z_above[i] = free_slots;
+        free_slots = i;
+    }
+    window_slots = cap;
+    return true;
+}
+
+int window_alloc(void) {
+    if (free_slots < 0 && !grow_windows()) return -1;
+    int slot = free_slots;
+    free_slots = z_above[slot];
+    return slot;
+}
+
+void window_update_geom(const window_t *w) {
+    int i = w - windows;
+    window_geom.x[i] = w->x;
+    window_geom.y[i] = w->y;
+    window_geom.w[i] = w->w;
+    window_geom.h[i] = w->minimized ? DECO_HEIGHT : w->h;
+    window_geom.flags[i] = !w->used ? 0 : GEOM_USED |
+        (!w->minimized && w->surface_mode == SQWS_SURFACE_OPAQUE && w->h > DECO_HEIGHT ? GEOM_OPAQUE : 0);
+    grid_update(i);
+}
+
+int window_top(void) { return z_top; }
+int window_bottom(void) { return z_bottom; }
+int window_below(int slot) { return z_below[slot]; }
+int window_above(int slot) { return z_above[slot]; }
+
+static void z_unlink(int slot) {
+    if (z_above[slot] >= 0) z_below[z_above[slot]] = z_below[slot];
+    else z_top = z_below[slot];
+    if (z_below[slot] >= 0) z_above[z_below[slot]] = z_above[slot];
+    else z_bottom = z_above[slot];
+}
+
+static void z_link_top(int slot) {
+    z_above[slot] = -1;
+    z_below[slot] = z_top;
+    if (z_top >= 0) z_above[z_top] = slot;
+    else z_bottom = slot;
+    z_top = slot;
+    window_geom.z[slot] = z_next_top++;
+}
+
+void window_raise(int slot) {
+    if (slot == z_top || !windows[slot].used) return;
+    z_unlink(slot);
+    z_link_top(slot);
+    damage_window(&windows[slot]);
+}
+
+void window_lower(int slot) {
+    if (slot == z_bottom || !windows[slot].used) return;
+    z_unlink(slot);
+    z_above[slot] = z_bottom;
+    z_below[slot] = -1;
+    z_below[z_bottom] = slot;
+    z_bottom = slot;
+    window_geom.z[slot] = z_next_bottom--;
+    damage_window(&windows[slot]);
+}
+
+void window_focus(int slot) {
+    if (slot >= 0 && !windows[slot].used) slot = -1;
+    if (slot != focused_slot) {
+        if (focused_slot >= 0) {
+            window_t *w = &windows[focused_slot];
+            w->focused = false;
+            window_invalidate_decorations(w);
+            damage_window(w);
+        }
+        focused_slot = slot;
+        if (slot >= 0) {
+            windows[slot].focused = true;
+            window_invalidate_decorations(&windows[slot]);
+            damage_window(&windows[slot]);
+        }
+    }
+    if (slot >= 0) window_raise(slot);
+}
+
+int get_focused_window_idx(void) {
+    return focused_slot;
+}
+
+// the decorations of such a window are off the output, it is only the canvas
+int window_covering_output(void) {
+    int slot = z_top;
+    if (slot < 0) return -1;
+    const window_t *w = &windows[slot];
+    if (w->minimized || !w->canvas || !w->drawn || w->surface_mode != SQWS_SURFACE_OPAQUE) return -1;
+    if (w->x + BORDER != 0 || w->y + BORDER + TITLEBAR_HEIGHT != 0) return -1;
+    return w->canvas_w == mode.hdisplay && w->canvas_h == mode.vdisplay ? slot : -1;
+}
+
+void window_invalidate_decorations(const window_t *w) {
+    deco_cache[w - windows].valid = false;
+}
+
+void window_free_decorations(const window_t *w) {
+    deco_cache_t *d = &deco_cache[w - windows];
+    free(d->pixels);
+    free(d->spans);
+    memset(d, 0, sizeof(*d));
+}
+
+static bool deco_add_span(deco_cache_t *d, int *count, int kind, int x, int n, const unsigned char *color) {
+    if (n <= 0) return true;
+    if (*count == d->span_cap) {
+        int cap = d->span_cap ? d->span_cap * 2 : 64;
+        deco_span_t *spans = realloc(d->spans, cap * sizeof(*spans));
+        if (!spans) return false;
+        d->spans = spans;
+        d->span_cap = cap;
+    }
+    deco_span_t *s = &d->spans[(*count)++];
+    s->x = x;
+    s->n = n;
+    s->kind = kind;
+    if (color) memcpy(&s->color, color, 4);
+    return true;
+}
+
+static bool deco_ready(const window_t *w) {
+    const deco_cache_t *d = &deco_cache[w - windows];
+    return d->valid && d->w == w->w;
+}
+
+static bool window_decorations(const window_t *w) {
+    deco_cache_t *d = &deco_cache[w - windows];
+    if (deco_ready(w)) return true;
+
+    if (d->w != w->w) {
+        free(d->pixels);
+        d->pixels = malloc((size_t)w->w * DECO_HEIGHT * 4);
+        d->w = d->pixels ? w->w : 0;
+        if (!d->pixels) {
+            fprintf(stderr, "failed to allocate window decorations\n");
+            return false;
+        }
+    }
 
     static const unsigned char text_color[4] = {255,255,255,255};
-    static const unsigned char border[4] = {40,40,40,255};
     unsigned char title[4] = {0, w->focused ? 200 : 128, 255, 200};
-    unsigned char bg[4] = {w->color[0], w->color[1], w->color[2], 255};
+    unsigned char *buf = (unsigned char *)d->pixels;
+    int pitch = w->w * 4, bar_w = w->w - 2 * BORDER;
+
+    // the bar is left transparent, so only text and buttons end up opaque
+    memset(buf, 0, (size_t)pitch * DECO_HEIGHT);
+    draw_text(buf, BORDER + 4, BORDER + 2, w->title, text_color, pitch, w->w - BORDER, DECO_HEIGHT);
+    draw_window_buttons(buf, w->w - BORDER - BTN_SPACING - BTN_SIZE, BORDER + (TITLEBAR_HEIGHT - BTN_SIZE) / 2,
+                        pitch, w->w, DECO_HEIGHT, w->maximized);
+
+    int count = 0;
+    bool ok = true;
+    for (int y = 0; y < DECO_HEIGHT && ok; y++) {
+        d->row_start[y] = count;
+        if (y < BORDER) {
+            ok = deco_add_span(d, &count, SPAN_FILL, 0, w->w, border_color);
+            continue;
+        }
+        ok = deco_add_span(d, &count, SPAN_FILL, 0, BORDER, border_color) &&
+             deco_add_span(d, &count, SPAN_FILL, w->w - BORDER, BORDER, border_color) &&
+             deco_add_span(d, &count, SPAN_BLEND, BORDER, bar_w, title);
+
+        const uint32_t *row = d->pixels + y * w->w;
+        for (int x = BORDER; x < w->w - BORDER && ok; x++) {
+            if (!row[x]) continue;
+            int start = x;
+            while (x < w->w - BORDER && row[x]) x++;
+            ok = deco_add_span(d, &count, SPAN_COPY, start, x - start, NULL);
+        }
+    }
+    d->row_start[DECO_HEIGHT] = count;
+    if (!ok) {
+        fprintf(stderr, "failed to allocate window decorations\n");
+        return false;
+    }
+    d->valid = true;
+    return true;
+}
 
-    if (w->x + w->w <= 0 || w->y + w->h <= 0 || w->x >= sw || w->y >= sh) return;
+// draws rows [y0, y1) of the decoration strip of w, whose top left corner is
+// at (wx, wy) in the view, clipped to columns [x0, x1) of the view
+static void draw_decorations(const window_t *w, unsigned char *buf, int wx, int wy,
+                             int x0, int x1, int y0, int y1, int pitch) {
+    const deco_cache_t *d = &deco_cache[w - windows];
+    for (int y = y0; y < y1; y++) {
+        int row = y - wy;
+        uint32_t *dst = (uint32_t *)(buf + y * pitch);
+        for (int i = d->row_start[row]; i < d->row_start[row + 1]; i++) {
+            const deco_span_t *s = &d->spans[i];
+            int sx0 = wx + s->x, sx1 = sx0 + s->n;
+            if (sx0 < x0) sx0 = x0;
+            if (sx1 > x1) sx1 = x1;
+            if (sx1 <= sx0) continue;
+            if (s->kind == SPAN_FILL) fill_span(dst + sx0, sx1 - sx0, s->color);
+            else if (s->kind == SPAN_BLEND) blend_span_solid(dst + sx0, sx1 - sx0, (const unsigned char *)&s->color);
+            else memcpy(dst + sx0, d->pixels + row * w->w + (sx0 - wx), (sx1 - sx0) * 4);
+        }
+    }
+}
 
-    int btn_y = w->y + BORDER + (TITLEBAR_HEIGHT - BTN_SIZE)/2;
-    int btn_x_start = w->x + w->w - BORDER - BTN_SPACING - BTN_SIZE;
+// builds the decoration caches that are out of date. draw_window only reads
+// them, so this runs before composing, on the thread that changes windows
+void window_prepare_decorations(void) {
+    for (int i = window_top(); i >= 0; i = window_below(i))
+        window_decorations(&windows[i]);
+}
 
-    if (w->minimized) {
-        int x0 = w->x < 0 ? 0 : w->x;
-        int y0 = w->y < 0 ? 0 : w->y;
-        int x1 = (w->x + w->w > sw) ? sw : (w->x + w->w);
-        int y1 = (w->y + TITLEBAR_HEIGHT + BORDER > sh) ? sh : (w->y + TITLEBAR_HEIGHT + BORDER);
-        if (x1 <= x0 || y1 <= y0) return;
+// buf points at screen pixel (ox, oy) and is sw x sh pixels large, so the
+// clipping in the primitives below clips to that view of the screen
+void draw_window(const window_t *w, unsigned char *buf, int ox, int oy, int pitch, int sw, int sh) {
+    if (!w->used) return;
 
-        draw_rect(buf, w->x, w->y, w->w, BORDER, border, 0, pitch, sw, sh);
-        draw_rect(buf, w->x, w->y, BORDER, TITLEBAR_HEIGHT + BORDER, border, 0, pitch, sw, sh);
-        draw_rect(buf, w->x + w->w - BORDER, w->y, BORDER, TITLEBAR_HEIGHT + BORDER, border, 0, pitch, sw, sh);
-        draw_rect(buf, w->x, w->y + BORDER, w->w, TITLEBAR_HEIGHT, title, 1, pitch, sw, sh);
+    unsigned char bg[4] = {w->color[0], w->color[1], w->color[2], 255};
+
+    int wx = w->x - ox, wy = w->y - oy;
+    if (wx + w->w <= 0 || wy + w->h <= 0 || wx >= sw || wy >= sh) return;
 
-        draw_text(buf, w->x + BORDER + 4, w->y + BORDER + 2, w->title, text_color, pitch, sw, sh);
-        draw_window_buttons(buf, btn_x_start, btn_y, pitch, sw, sh, w->maximized);
-        return;
+    if (deco_ready(w)) {
+        int x0 = wx < 0 ? 0 : wx, x1 = wx + w->w > sw ? sw : wx + w->w;
+        int y0 = wy < 0 ? 0 : wy, y1 = wy + DECO_HEIGHT > sh ? sh : wy + DECO_HEIGHT;
+        draw_decorations(w, buf, wx, wy, x0, x1, y0, y1, pitch);
     }
+    if (w->minimized) return;
 
-    int cx = w->x + BORDER, cy = w->y + BORDER + TITLEBAR_HEIGHT;
+    int cx = wx + BORDER, cy = wy + BORDER + TITLEBAR_HEIGHT;
     int cw = w->w - 2 * BORDER, ch = w->h - TITLEBAR_HEIGHT - 2 * BORDER;
-    
-    draw_rect(buf, w->x, w->y, w->w, BORDER, border, 0, pitch, sw, sh);
-    draw_rect(buf, w->x, w->y, BORDER, w->h, border, 0, pitch, sw, sh);
-    draw_rect(buf, w->x + w->w - BORDER, w->y, BORDER, w->h, border, 0, pitch, sw, sh);
-    draw_rect(buf, w->x, w->y + w->h - BORDER, w->w, BORDER, border, 0, pitch, sw, sh);
 
-    draw_rect(buf, cx, w->y + BORDER, cw, TITLEBAR_HEIGHT, title, 1, pitch, sw, sh);
-    draw_text(buf, w->x + BORDER + 4, w->y + BORDER + 2, w->title, text_color, pitch, sw, sh);
-    draw_window_buttons(buf, btn_x_start, btn_y, pitch, sw, sh, w->maximized);
+    draw_rect(buf, wx, wy + DECO_HEIGHT, BORDER, w->h - DECO_HEIGHT, border_color, 0, pitch, sw, sh);
+    draw_rect(buf, wx + w->w - BORDER, wy + DECO_HEIGHT, BORDER, w->h - DECO_HEIGHT, border_color, 0, pitch, sw, sh);
+    draw_rect(buf, wx, wy + w->h - BORDER, w->w, BORDER, border_color, 0, pitch, sw, sh);
 
-    draw_rect(buf, cx, cy, cw, ch, bg, 0, pitch, sw, sh);
-    if (!w->canvas) return;
+    // the canvas may not match the content area, e.g. a shared canvas after
+    // maximize. only the part it doesn't cover gets the background colour,
+    // all of it until the client has drawn something
+    bool shown = w->canvas && w->drawn;
+    int canvas_w = shown ? (w->canvas_w < cw ? w->canvas_w : cw) : 0;
+    int canvas_h = shown ? (w->canvas_h < ch ? w->canvas_h : ch) : 0;
+    if (canvas_w < cw) draw_rect(buf, cx + canvas_w, cy, cw - canvas_w, ch, bg, 0, pitch, sw, sh);
+    if (canvas_h < ch) draw_rect(buf, cx, cy + canvas_h, canvas_w, ch - canvas_h, bg, 0, pitch, sw, sh);
+    if (!canvas_w || !canvas_h) return;
 
     int dst_x = cx < 0 ? 0 : cx;
     int src_x = cx < 0 ? -cx : 0;
-    int vis_width = cw - src_x;
+    int vis_width = canvas_w - src_x;
     if (dst_x + vis_width > sw) vis_width = sw - dst_x;
     if (vis_width <= 0) return;
 
-    int vis_height = ch;
-    if (cy < 0) {
-        vis_height += cy; cy = 0;
-    }
-    if (cy + vis_height > sh) vis_height = sh - cy;
+    int dst_y = cy < 0 ? 0 : cy;
+    int src_y = cy < 0 ? -cy : 0;
+    int vis_height = canvas_h - src_y;
+    if (dst_y + vis_height > sh) vis_height = sh - dst_y;
     if (vis_height <= 0) return;
-    
-#if 1
-    for (int y = 0; y < vis_height; y++) {
-        for (int x = 0; x < vis_width; x++) {
-            put_pixel(buf, dst_x + x, cy + y,
-                    w->canvas + (y * cw + src_x + x) * 4,
-                    pitch, sw, sh);
-        }
+
+    blit_rect(buf + dst_y * pitch + dst_x * 4, pitch,
+              w->canvas + ((size_t)src_y * w->canvas_w + src_x) * 4, w->canvas_w * 4,
+              vis_width, vis_height, w->surface_mode);
+}
+
+// parts of a window that hide whatever is below them: the top border and,
+// unless the canvas is see-through, everything below the title bar. the
+// title bar itself is translucent
+static int window_opaque_rects(int i, rect_t out[2]) {
+    int x = window_geom.x[i], y = window_geom.y[i], x1 = x + window_geom.w[i];
+    int n = 0;
+    out[n++] = (rect_t){x, y, x1, y + BORDER};
+    if (window_geom.flags[i] & GEOM_OPAQUE)
+        out[n++] = (rect_t){x, y + DECO_HEIGHT, x1, y + window_geom.h[i]};
+    return n;
+}
+
+static bool draw_list_add(compose_ctx_t *ctx, int window, const rect_t *r) {
+    if (ctx->count == ctx->cap) {
+        int cap = ctx->cap ? ctx->cap * 2 : 64;
+        draw_item_t *items = realloc(ctx->items, cap * sizeof(*items));
+        if (!items) return false;
+        ctx->items = items;
+        ctx->cap = cap;
+    }
+    ctx->items[ctx->count++] = (draw_item_t){window, *r};
+    return true;
+}
+
+static void draw_view(const window_t *w, unsigned char *buf, int pitch, const rect_t *r) {
+    draw_window(w, buf + r->y0 * pitch + r->x0 * 4, r->x0, r->y0, pitch, r->x1 - r->x0, r->y1 - r->y0);
+}
+
+// without memory for the lists, paint everything back to front
+static void compose_rect_all(unsigned char *buf, int pitch, const rect_t *r) {
+    for (int y = r->y0; y < r->y1; y++)
+        memset(buf + y * pitch + r->x0 * 4, 0, (r->x1 - r->x0) * 4);
+    for (int i = window_bottom(); i >= 0; i = window_above(i))
+        draw_view(&windows[i], buf, pitch, r);
+}
+
+// the visible pieces of each window are collected top to bottom and drawn
+// bottom to top, the background is only cleared where no opaque window
+// covers it. windows[] and the decoration caches are only read, so several
+// threads can compose disjoint rects at once
+void compose_rect(compose_ctx_t *ctx, unsigned char *buf, int pitch, const rect_t *r) {
+    region_t *visible = &ctx->visible, *uncovered = &ctx->uncovered;
+    int ncovers = 0;
+    ctx->count = 0;
+
+    if (!grid_query(r, &ctx->found)) goto fallback;
+    if (ctx->covers_cap < ctx->found.count * 2) {
+        rect_t *covers = realloc(ctx->covers, ctx->found.count * 2 * sizeof(*covers));
+        if (!covers) goto fallback;
+        ctx->covers = covers;
+        ctx->covers_cap = ctx->found.count * 2;
     }
-#endif
+    rect_t *covers = ctx->covers;
+
+    for (int k = 0; k < ctx->found.count; k++) {
+        int i = ctx->found.items[k];
+        int x = window_geom.x[i], y = window_geom.y[i];
+        int x1 = x + window_geom.w[i], y1 = y + window_geom.h[i];
+        rect_t bounds = {
+            x > r->x0 ? x : r->x0, y > r->y0 ? y : r->y0,
+            x1 < r->x1 ? x1 : r->x1, y1 < r->y1 ? y1 : r->y1,
+        };
+        if (bounds.x1 <= bounds.x0 || bounds.y1 <= bounds.y0) continue;
+
+        if (!region_set(visible, &bounds)) goto fallback;
+        for (int k = 0; k < ncovers && visible->count; k++)
+            if (!region_subtract(visible, &covers[k])) goto fallback;
+        for (int k = 0; k < visible->count; k++)
+            if (!draw_list_add(ctx, i, &visible->rects[k])) goto fallback;
+
+        ncovers += window_opaque_rects(i, &covers[ncovers]);
+    }
+
+    if (!region_set(uncovered, r)) goto fallback;
+    for (int k = 0; k < ncovers && uncovered->count; k++)
+        if (!region_subtract(uncovered, &covers[k])) goto fallback;
+
+    for (int k = 0; k < uncovered->count; k++) {
+        const rect_t *u = &uncovered->rects[k];
+        for (int y = u->y0; y < u->y1; y++)
+            memset(buf + y * pitch + u->x0 * 4, 0, (u->x1 - u->x0) * 4);
+    }
+    for (int k = ctx->count - 1; k >= 0; k--)
+        draw_view(&windows[ctx->items[k].window], buf, pitch, &ctx->items[k].rect);
+    return;
+
+fallback:
+    compose_rect_all(buf, pitch, r);
+}
+
+void compose_ctx_free(compose_ctx_t *ctx) {
+    free(ctx->items);
+    free(ctx->found.items);
+    free(ctx->covers);
+    region_free(&ctx->visible);
+    region_free(&ctx->uncovered);
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void damage_window(const window_t *w) {
+    if (!w->used) return;
+    int h = w->minimized ? TITLEBAR_HEIGHT + BORDER : w->h;
+    damage_add(&screen_damage, w->x, w->y, w->w, h);
+}
+
+// x, y, cw, ch in canvas coordinates
+void damage_canvas(const window_t *w, int x, int y, int cw, int ch) {
+    if (!w->used || w->minimized) return;
+    int content_w = w->w - 2 * BORDER, content_h = w->h - TITLEBAR_HEIGHT - 2 * BORDER;
+    if (x + cw > content_w) cw = content_w - x;
+    if (y + ch > content_h) ch = content_h - y;
+    if (cw <= 0 || ch <= 0) return;
+    damage_add(&screen_damage, w->x + BORDER + x, w->y + BORDER + TITLEBAR_HEIGHT + y, cw, ch);
+}
+
+void window_free_canvas(window_t *w) {
+    if (w->shm_map) {
+        munmap(w->shm_map, w->shm_size);
+        if (w->shm_fd >= 0) close(w->shm_fd);
+        w->shm_fd = -1;
+        w->shm_map = NULL;
+        w->shm_size = 0;
+    } else {
+        surface_free(w->canvas, (size_t)w->canvas_w * w->canvas_h * 4);
+    }
+    w->canvas = NULL;
+    w->drawn = false;
 }
 
-void redraw_all(unsigned char *buf, int pitch, int sw, int sh) {
-    unsigned char *back_buf = malloc(pitch * sh);
-    if (!back_buf) return;
-    memset(back_buf, 0, pitch * sh);
-    for (int i = 0; i < MAX_WINDOWS; i++) {
-        draw_window(&windows[i], back_buf, pitch, sw, sh);
+void window_drop_next(window_t *w) {
+    surface_free(w->next_canvas, (size_t)w->configure_w * w->configure_h * 4);
+    if (w->next_shm_map) {
+        munmap(w->next_shm_map, w->next_shm_size);
+        if (w->next_shm_fd >= 0) close(w->next_shm_fd);
     }
-    memcpy(buf, back_buf, pitch * sh);
-    free(back_buf);
-}
-
-void draw_cursor(unsigned char *buf, int pitch, int sw, int sh, int cx, int cy) {
-    unsigned char c[4] = {100, 100, 100, 255};
-    for (int y = -3; y <= 3; y++) {
-        int py = cy + y;
-        if (py < 0 || py >= sh) continue;
-        for (int x = -3; x <= 3; x++) {
-            int px = cx + x;
-            if (px < 0 || px >= sw) continue;
-            put_pixel(buf, px, py, c, pitch, sw, sh);
+    w->next_canvas = NULL;
+    w->next_shm_map = NULL;
+    w->next_shm_size = 0;
+    w->next_shm_fd = -1;
+}
+
+bool window_stage_canvas(window_t *w) {
+    if (!w->next_canvas) w->next_canvas = surface_alloc((size_t)w->configure_w * w->configure_h * 4);
+    return w->next_canvas != NULL;
+}
+
+// the canvas changes hands without a copy, the old one goes back to the pool.
+// a shared canvas wins over an uploaded one, which is freed if there is one
+void window_adopt_next(window_t *w) {
+    unsigned char *canvas = w->next_canvas, *shm_map = w->next_shm_map;
+    size_t shm_size = w->next_shm_size;
+    int shm_fd = shm_map ? w->next_shm_fd : -1;
+    if (shm_map && canvas) {
+        surface_free(canvas, (size_t)w->configure_w * w->configure_h * 4);
+        canvas = NULL;
+    }
+    w->next_canvas = w->next_shm_map = NULL;
+    w->next_shm_size = 0;
+    w->next_shm_fd = -1;
+    window_free_canvas(w);
+    w->canvas_w = w->configure_w;
+    w->canvas_h = w->configure_h;
+    w->canvas = shm_map ? shm_map : canvas;
+    w->shm_map = shm_map;
+    w->shm_size = shm_size;
+    w->shm_fd = shm_fd;
+    w->shm_front = 0;
+    w->drawn = true;
+    w->configure_acked = false;
+    damage_window(w);
+}
+
+void (*configure_hook)(int slot) = NULL;
+
+void window_configure(window_t *w, int cw, int ch) {
+    if (cw < 1) cw = 1;
+    if (ch < 1) ch = 1;
+    window_drop_next(w);
+    w->configure_serial++;
+    w->configure_w = cw;
+    w->configure_h = ch;
+    w->configure_acked = false;
+
+    damage_window(w);
+    w->w = cw + 2 * BORDER;
+    w->h = ch + TITLEBAR_HEIGHT + 2 * BORDER;
+    window_invalidate_decorations(w);
+    window_update_geom(w);
+    damage_window(w);
+
+    if (configure_hook) configure_hook(w - windows);
+}
+
+// the frame is put just so far off the output that only the canvas is on it,
+// hit tests, damage and input positions work as for any other window
+void window_set_fullscreen(window_t *w, bool on) {
+    if (on == w->fullscreen) return;
+    if (on) {
+        // leaving it goes back to the size from before maximizing
+        if (!w->maximized) {
+            w->prev_x = w->x;
+            w->prev_y = w->y;
+            w->prev_w = w->w;
+            w->prev_h = w->h;
         }
+        w->fullscreen = true;
+        w->maximized = false;
+        w->minimized = false;
+        handle_move(w, -BORDER, -BORDER - TITLEBAR_HEIGHT);
+        window_configure(w, mode.hdisplay, mode.vdisplay);
+        window_focus(w - windows);
+    } else {
+        w->fullscreen = false;
+        handle_move(w, w->prev_x, w->prev_y);
+        window_configure(w, w->prev_w - 2 * BORDER, w->prev_h - TITLEBAR_HEIGHT - 2 * BORDER);
     }
 }
 
+// the slots stay allocated, so generations of stale ids keep counting up
 void free_windows() {
-    for (int i = 0; i < MAX_WINDOWS; i++) {
-        if (windows[i].canvas) free(windows[i].canvas);
-        windows[i].canvas = NULL;
-        windows[i].used = false;
-    }
+    while (z_top >= 0) handle_destroy(z_top);
 }
 
 bool point_in_rect(int px, int py, int x, int y, int w, int h) {
@@ -226,77 +624,32 @@ void process_window_buttons(window_t *w, int mx, int my) {
         if (point_in_rect(mx, my, btn_x, btn_y, BTN_SIZE, BTN_SIZE)) {
             switch (i) {
                 case CLOSE:
-                    w->used = false;
+                    handle_destroy(w - windows);
                     return;
 
                 case MINIMIZE:
+                    damage_window(w);
                     w->minimized = !w->minimized;
+                    window_update_geom(w);
+                    damage_window(w);
                     return;
 
                 case MAXIMIZE:
+                    // the client redraws at the new size, until then the
+                    // canvas it has is shown clipped or padded
                     if (!w->maximized) {
-                        // save old size and pos
                         w->prev_x = w->x;
                         w->prev_y = w->y;
                         w->prev_w = w->w;
                         w->prev_h = w->h;
-                        w->prev_canvas_w = w->canvas_w;
-                        w->prev_canvas_h = w->canvas_h;
-
-                        int new_w = mode.hdisplay;
-                        int new_h = mode.vdisplay;
-                        int new_canvas_w = new_w - 2 * BORDER;
-                        int new_canvas_h = new_h - TITLEBAR_HEIGHT - 2 * BORDER;
-
-                        unsigned char *new_canvas = malloc(new_canvas_w * new_canvas_h * 4);
-                        if (new_canvas) {
-                            memset(new_canvas, 0, new_canvas_w * new_canvas_h * 4);
-                            int copy_h = (w->canvas_h < new_canvas_h) ? w->canvas_h : new_canvas_h;
-                            int copy_w = (w->canvas_w < new_canvas_w) ? w->canvas_w : new_canvas_w;
-                            for (int row = 0; row < copy_h; row++) {
-                                memcpy(new_canvas + row * new_canvas_w * 4,
-                                       w->canvas + row * w->canvas_w * 4,
-                                       copy_w * 4);
-                            }
-                            free(w->canvas);
-                            w->canvas = new_canvas;
-                            w->x = 0;
-                            w->y = 0;
-                            w->w = new_w;
-                            w->h = new_h;
-                            w->canvas_w = new_canvas_w;
-                            w->canvas_h = new_canvas_h;
-                            w->maximized = true;
-                            w->minimized = false;
-                        } else {
-                            fprintf(stderr, "malloc failed for maximize\n");
-                        }
+                        w->maximized = true;
+                        w->minimized = false;
+                        handle_move(w, 0, 0);
+                        window_configure(w, mode.hdisplay - 2 * BORDER, mode.vdisplay - TITLEBAR_HEIGHT - 2 * BORDER);
                     } else {
-                        int new_canvas_w = w->prev_canvas_w;
-                        int new_canvas_h = w->prev_canvas_h;
-
-                        unsigned char *new_canvas = malloc(new_canvas_w * new_canvas_h * 4);
-                        if (new_canvas) {
-                            memset(new_canvas, 0, new_canvas_w * new_canvas_h * 4);
-                            int copy_h = (w->canvas_h < new_canvas_h) ? w->canvas_h : new_canvas_h;
-                            int copy_w = (w->canvas_w < new_canvas_w) ? w->canvas_w : new_canvas_w;
-                            for (int row = 0; row < copy_h; row++) {
-                                memcpy(new_canvas + row * new_canvas_w * 4,
-                                       w->canvas + row * w->canvas_w * 4,
-                                       copy_w * 4);
-                            }
-                            free(w->canvas);
-                            w->canvas = new_canvas;
-                            w->x = w->prev_x;
-                            w->y = w->prev_y;
-                            w->w = w->prev_w;
-                            w->h = w->prev_h;
-                            w->canvas_w = new_canvas_w;
-                            w->canvas_h = new_canvas_h;
-                            w->maximized = false;
-                        } else {
-                            fprintf(stderr, "malloc failed for unmaximize\n");
-                        }
+                        w->maximized = false;
+                        handle_move(w, w->prev_x, w->prev_y);
+                        window_configure(w, w->prev_w - 2 * BORDER, w->prev_h - TITLEBAR_HEIGHT - 2 * BORDER);
                     }
                     return;
             }
@@ -305,16 +658,19 @@ void process_window_buttons(window_t *w, int mx, int my) {
     }
 }
 
-void handle_move(window_t *w, int dx, int dy) {
+void handle_move(window_t *w, int x, int y) {
     if (!w->used) return;
-    w->x = dx;
-    w->y = dy;
+    if (w->x == x && w->y == y) return;
+    damage_window(w);
+    w->x = x;
+    w->y = y;
+    window_update_geom(w);
+    damage_window(w);
 }
 
 void handle_create(int idx, const char *title, int x, int y, int content_w, int content_h, const unsigned char *color) {
-    if (idx < 0 || idx >= MAX_WINDOWS) return;
+    if (idx < 0 || idx >= window_slots || windows[idx].used) return;
     window_t *win = &windows[idx];
-    if (win->used && win->canvas) free(win->canvas);
 
     win->x = x; win->y = y;
     win->canvas_w = content_w > 0 ? content_w : 1;
@@ -323,27 +679,45 @@ void handle_create(int idx, const char *title, int x, int y, int content_w, int
     win->w = win->canvas_w + 2 * BORDER;
     win->h = win->canvas_h + TITLEBAR_HEIGHT + 2 * BORDER;
     *(uint32_t *)win->color = *(const uint32_t *)color;
-    snprintf(win->title, sizeof(win->title), "%s", title);
+    // don't keep half a UTF-8 sequence where the title gets cut off
+    snprintf(win->title, sizeof(win->title), "%.*s", utf8_trim(title, sizeof(win->title) - 1), title);
     win->focused = false;
-
-    int cw = content_w;
-    int ch = content_h;
-    if (cw <= 0) cw = 1;
-    if (ch <= 0) ch = 1;
-
-    win->canvas = malloc(cw * ch * 4);
-    if (win->canvas) memset(win->canvas, 255, cw * ch * 4);
-    else {
-        fprintf(stderr, "failed to allocate window canvas\n");
-    }
+    win->minimized = win->maximized = win->fullscreen = false;
+    win->scanout_frame = 0;
+    win->shm_fd = win->next_shm_fd = -1;
+    win->surface_mode = SQWS_SURFACE_OPAQUE;
+    window_invalidate_decorations(win);
+
+    // reads as zero, the background is shown until the client draws
+    win->canvas = surface_alloc((size_t)win->canvas_w * win->canvas_h * 4);
+    win->drawn = false;
+    win->configure_w = win->canvas_w;
+    win->configure_h = win->canvas_h;
+    win->configure_acked = false;
+    win->configure_unsent = false;
+    if (!win->canvas) fprintf(stderr, "failed to allocate window canvas\n");
     win->used = true;
+    win->gen++;
+    win->owner = NULL;
+    window_count++;
+    z_link_top(idx);
+    window_update_geom(win);
+    damage_window(win);
 }
 
 void handle_destroy(int idx) {
-    if (idx < 0 || idx >= MAX_WINDOWS) return;
-    if (windows[idx].used) {
-        free(windows[idx].canvas);
-        windows[idx].canvas = NULL;
-        windows[idx].used = false;
-    }
+    if (idx < 0 || idx >= window_slots || !windows[idx].used) return;
+    window_t *win = &windows[idx];
+    if (idx == focused_slot) focused_slot = -1;
+    damage_window(win);
+    window_free_canvas(win);
+    window_drop_next(win);
+    window_free_decorations(win);
+    win->used = false;
+    win->owner = NULL;
+    window_count--;
+    window_update_geom(win);
+    z_unlink(idx);
+    z_above[idx] = free_slots;
+    free_slots = idx;
 }
@@ -5,21 +5,95 @@
 #include <linux/fb.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <sys/types.h>
 #include <xf86drm.h>
 #include <xf86drmMode.h>
 #include <libdrm/drm.h>
 #include <libdrm/drm_mode.h>
 
-#define MAX_WINDOWS 64
+#include "sqwsproto.h"
 
-extern struct pollfd *fds;
+// loop.c: epoll based event loop, see there
+typedef struct loop_source loop_source_t;
+typedef void (*loop_fn_t)(loop_source_t *src, uint32_t events);
+
+struct loop_source {
+    int fd; // -1 when not registered
+    uint32_t events;
+    loop_fn_t fn;
+    void *data;
+    bool polled; // false for fds epoll can't watch
+    bool deferred;
+};
+
+bool loop_init(void);
+void loop_cleanup(void);
+bool loop_add(loop_source_t *src, int fd, uint32_t events, loop_fn_t fn, void *data);
+bool loop_modify(loop_source_t *src, uint32_t events);
+void loop_remove(loop_source_t *src);
+// calls src again on the next dispatch, with no events, without waiting
+bool loop_defer(loop_source_t *src);
+// waits for at most timeout_ms, -1 for ever, and calls whatever is ready
+int loop_dispatch(int timeout_ms);
+
+// per-client protocol state, see clients.c
+#define CLIENT_MAX_FDS 4
+// window ids are a byte in the protocol
+#define CLIENT_MAX_WINDOWS 256
+
+enum { CLIENT_RX_CMD, CLIENT_RX_PIXELS };
 
 typedef struct {
-    int *fds;
+    int fd;
+    size_t index; // in client_array_t
+    loop_source_t source;
+    int state; // CLIENT_RX_*
+    bool pending; // stopped at its budget with input left to handle
+
+    unsigned char rx[32768];
+    size_t rx_len;
+    unsigned char tx[4096];
+    size_t tx_len;
+
+    int passed_fds[CLIENT_MAX_FDS];
+    int nfds;
+
+    // the client's windows by the id it was handed on creation: slot + 1 in
+    // windows[], 0 for none, and the slot's generation back then
+    int win_slot[CLIENT_MAX_WINDOWS];
+    uint32_t win_gen[CLIENT_MAX_WINDOWS];
+
+    // pixel payload being received: rects of window px_window, the current
+    // rect, row and byte offset in that row
+    int32_t px_rects[255][4];
+    int px_count, px_rect, px_row;
+    size_t px_offset;
+    int px_window; // slot, -1 to drop them
+    uint32_t px_gen;
+    bool px_whole;
+    bool px_next; // into next_canvas, which is shown once they are all in
+
+    // a commit reply held back until frame release_frame is done, because
+    // the buffer it releases is being scanned out. nothing else is parsed
+    // from the client meanwhile, so replies stay in order
+    int release_buffer; // -1 for none
+    uint8_t release_id;
+    uint64_t release_frame;
+
+    bool configure_unsent; // one of its windows has a configure_unsent
+    bool overflowed; // lost a key or button event, dropped on its next turn
+} client_t;
+
+typedef struct {
+    client_t **items;
     size_t size;
     size_t capacity;
 } client_array_t;
 
+// window frame, the canvas starts at (x + BORDER, y + BORDER + TITLEBAR_HEIGHT)
+#define TITLEBAR_HEIGHT 20
+#define BORDER 3
+
 typedef struct {
     bool used;
     int x, y, w, h, canvas_w, canvas_h;
@@ -32,39 +106,303 @@ typedef struct {
     bool minimized;
     bool maximized;
     int prev_x, prev_y, prev_w, prev_h, prev_canvas_w, prev_canvas_h;
+
+    // client-shared canvas, canvas points at the buffer being shown
+    unsigned char *shm_map;
+    size_t shm_size;
+    int shm_front;
+
+    int surface_mode; // SQWS_SURFACE_*
+
+    // server side only
+    uint32_t gen; // bumped whenever the slot gets a new window
+    client_t *owner;
+    uint8_t id; // what the owner calls it
+    bool drawn; // the canvas got pixels, until then the background shows
+
+    // resize handshake, see SQWS_MSG_CONFIGURE: the canvas size the client
+    // was last asked for and whether it acked that. the canvas keeps showing
+    // until one of that size has been uploaded into next_canvas, or a shared
+    // one attached as next_shm_map has been committed
+    uint32_t configure_serial;
+    int configure_w, configure_h;
+    bool configure_acked;
+    bool configure_unsent; // the owner's queue was full, sent once it drains
+    unsigned char *next_canvas;
+    unsigned char *next_shm_map;
+    size_t next_shm_size;
+
+    // the memfds behind shm_map and next_shm_map, valid while they are set
+    int shm_fd, next_shm_fd;
+    bool fullscreen;
+    // the last frame that scanned out its shared canvas as it is, 0 for none
+    uint64_t scanout_frame;
 } window_t;
 
+// windows[] is indexed by slot and grows as needed. what hit testing and
+// culling look at is mirrored in window_geom, one packed array per field:
+// the frame, only the title bar of a minimized window, and GEOM_OPAQUE when
+// everything below the title bar hides what is behind it. it has to be
+// refreshed with window_update_geom() whenever any of that changes
+enum { GEOM_USED = 1, GEOM_OPAQUE = 2 };
+
+typedef struct {
+    int *x, *y, *w, *h;
+    uint8_t *flags; // GEOM_*
+    int64_t *z; // stacking order, higher is above
+} window_geom_t;
+
+extern window_geom_t window_geom;
+
+typedef struct {
+    int x0, y0, x1, y1;
+} rect_t;
+
+#define MAX_DAMAGE_RECTS 32
+
+typedef struct {
+    rect_t rects[MAX_DAMAGE_RECTS];
+    int count;
+} damage_t;
+
+extern damage_t screen_damage;
+
+// a set of disjoint rects, grown as needed
+typedef struct {
+    rect_t *rects;
+    int count, cap;
+} region_t;
+
+bool region_set(region_t *r, const rect_t *rect);
+bool region_subtract(region_t *r, const rect_t *hole);
+void region_free(region_t *r);
+
+void damage_add(damage_t *d, int x, int y, int w, int h);
+void damage_add_rect(damage_t *d, const rect_t *r);
+void damage_clear(damage_t *d);
+void damage_all(void);
+
+#define SCHED_NEVER UINT64_MAX
+
+typedef struct frame_sched frame_sched_t;
+
+// where finished frames go. present() queues the back buffer for scanout and
+// reports completion through sched_frame_done(), either right away or from
+// dispatch() once event_fd() becomes readable
+typedef struct {
+    void *ctx;
+    uint64_t (*now)(void *ctx);
+    bool (*present)(void *ctx, frame_sched_t *sched);
+    int (*event_fd)(void *ctx);
+    void (*dispatch)(void *ctx);
+} presenter_t;
+
+struct frame_sched {
+    const presenter_t *presenter;
+    uint64_t refresh_ns;
+    uint64_t margin_ns;
+    uint64_t last_vblank_ns;
+    bool frame_pending;
+    uint64_t frames_presented, frames_done;
+};
+
+uint64_t clock_now_ns(void);
+uint64_t mode_refresh_ns(const drmModeModeInfo *m);
+
+void sched_init(frame_sched_t *s, const presenter_t *p, uint64_t refresh_ns);
+uint64_t sched_deadline(const frame_sched_t *s, bool dirty);
+int sched_timeout_ms(const frame_sched_t *s, bool dirty);
+bool sched_repaint_due(const frame_sched_t *s, bool dirty);
+bool sched_present(frame_sched_t *s);
+void sched_frame_done(frame_sched_t *s, uint64_t vblank_ns);
+
+// a display the composed frames end up on
+typedef struct {
+    const char *name;
+    bool (*init)(void);     // sets up the output and fills in mode
+    void (*cleanup)(void);
+    // returns the buffer to compose into and which part of it needs composing
+    unsigned char *(*begin_frame)(const damage_t *damage, damage_t *repaint, int *pitch);
+    const presenter_t *presenter;
+    // shows the canvas of w, which covers the whole output with nothing over
+    // it, instead of a composed frame: copied into the buffer to present, or
+    // scanned out as it is when the backend can, which sets *zero_copy.
+    // false if the frame has to be composed
+    bool (*bypass)(const window_t *w, const damage_t *damage, bool *zero_copy);
+    // default input devices, NULL when the output has none
+    const char *mouse_dev;
+    const char *keyboard_dev; // glob pattern
+} output_backend_t;
+
+extern const output_backend_t drm_backend;
+extern const output_backend_t headless_backend;
+extern const output_backend_t *output;
+
 bool fb_init();
 void fb_cleanup();
-void fb_flush();
+unsigned char *fb_begin_frame(const damage_t *damage, damage_t *repaint, int *pitch);
+bool fb_bypass(const window_t *w, const damage_t *damage, bool *zero_copy);
+// copies region of the canvas of a window covering the output into dst
+void fb_copy_canvas(unsigned char *dst, int pitch, const window_t *w, const damage_t *region);
+
 
 #define MAX_VK_CODE 256
-extern bool keys_pressed[MAX_VK_CODE];
 
 extern int mouse_fd, mouse_x, mouse_y;
 extern bool mouse_left;
 
 bool mouse_init(void);
 void mouse_cleanup(void);
-void mouse_process(int *drag_window, int *dx, int *dy);
+// the cursor follows motion once per frame, see events.c
+bool mouse_motion_pending(void);
+void mouse_flush_motion(void);
 
 bool keyboard_init(void);
 void keyboard_cleanup(void);
-void keyboard_process(client_array_t *clients);
+
+void clients_init(client_array_t *clients);
+void clients_free(client_array_t *clients);
+client_t *clients_add(client_array_t *clients, int fd);
+void clients_remove(client_array_t *clients, client_t *c);
+// false when the client is gone or broke the protocol and has to be dropped
+bool client_read(client_t *c);
+bool client_flush(client_t *c);
+// pushes a SQWS_MSG_* input event to the client owning windows[slot]
+void clients_push_input(int type, int slot, const sqws_input_t *in);
+// sends the commit replies that were waiting for a frame to be done
+void clients_frame_done(client_array_t *clients);
+// server.c: frames presented and shown so far, numbered from 1
+uint64_t frames_presented(void);
+uint64_t frames_done(void);
 
 void process_window_buttons(window_t *w, int mx, int my);
 
 void free_windows(void);
 
+// takes a free slot for handle_create, -1 when out of memory
+int window_alloc(void);
+void window_update_geom(const window_t *w);
+// stacking order, used slots only: for (i = window_top(); i >= 0; i = window_below(i))
+int window_top(void);
+int window_bottom(void);
+int window_below(int slot);
+int window_above(int slot);
+void window_raise(int slot);
+void window_lower(int slot);
+// focuses and raises windows[slot], -1 to focus none
+void window_focus(int slot);
+int get_focused_window_idx(void);
+// the topmost window if its canvas is opaque and covers the whole output
+// exactly, which is all there is to show then. -1 otherwise
+int window_covering_output(void);
+
+typedef struct {
+    int *items;
+    int count, cap;
+} slot_list_t;
+
+// grid.c: which windows are where, kept up to date by window_update_geom
+void grid_update(int slot);
+void grid_cleanup(void);
+// the topmost window at a point, -1 for none
+int grid_window_at(int x, int y);
+// the windows overlapping r, top to bottom. false when out of memory
+bool grid_query(const rect_t *r, slot_list_t *out);
+
+// new windows go on top, destroyed ones give their slot back
 void handle_create(int idx, const char *title, int x, int y, int w, int h, const unsigned char *color);
 void handle_destroy(int idx);
+void window_free_canvas(window_t *w);
+// title bar cache, to be invalidated whenever focus, title, width or the
+// maximized state of a window changes
+void window_invalidate_decorations(const window_t *w);
+void window_free_decorations(const window_t *w);
+
+// surface.c: zero-filled, page aligned pixel buffers, pooled by size
+void *surface_alloc(size_t size);
+// size as it was allocated with
+void surface_free(void *p, size_t size);
+void surface_cleanup(void);
+
+// fd holds canvases of cw x ch, refused unless that is the size expected
+bool shm_attach(window_t *w, int fd, int cw, int ch);
+int shm_commit(window_t *w, int buffer);
+void handle_move(window_t *w, int x, int y);
+// puts the canvas over the whole output, the decorations off it
+void window_set_fullscreen(window_t *w, bool on);
+// resizes the frame to fit a canvas of cw x ch and asks the owner for one
+// through configure_hook, which clients_init installs
+void window_configure(window_t *w, int cw, int ch);
+extern void (*configure_hook)(int slot);
+// allocates next_canvas for an upload at the acked size
+bool window_stage_canvas(window_t *w);
+// shows the next canvas, shared or not, in place of the current one
+void window_adopt_next(window_t *w);
+void window_drop_next(window_t *w);
+
+void damage_window(const window_t *w);
+void damage_canvas(const window_t *w, int x, int y, int cw, int ch);
+
+// scratch lists for compose_rect, one per composing thread
+typedef struct {
+    int window;
+    rect_t rect;
+} draw_item_t;
+
+typedef struct {
+    draw_item_t *items;
+    int count, cap;
+    slot_list_t found;
+    rect_t *covers;
+    int covers_cap;
+    region_t visible, uncovered;
+} compose_ctx_t;
+
+void window_prepare_decorations(void);
+void compose_rect(compose_ctx_t *ctx, unsigned char *buf, int pitch, const rect_t *r);
+void compose_ctx_free(compose_ctx_t *ctx);
 
+// compose.c: splits the redraw into tiles composed by a pool of threads
+bool compose_init(void);
+void compose_cleanup(void);
+int compose_threads(void);
 void redraw_all(unsigned char *buf, int pitch, int sw, int sh);
-void draw_cursor(unsigned char *buf, int pitch, int sw, int sh, int cx, int cy);
+void redraw_damage(unsigned char *buf, int pitch, int sw, int sh, const damage_t *damage);
+
+// cursor.c: the pointer, drawn over the composed frame into each presented
+// buffer with what it covers there saved in a cursor_save_t
+typedef struct {
+    bool shown;
+    rect_t rect; // where it is in the buffer, clipped to the screen
+    int x, y; // the mouse position it was drawn for
+    uint32_t gen;
+    uint32_t *under;
+    size_t under_cap;
+} cursor_save_t;
+
+bool cursor_init(void);
+void cursor_cleanup(void);
+// ARGB, (hot_x, hot_y) being the pixel at the mouse position. shown from the
+// next frame that is presented
+bool cursor_set_sprite(const uint32_t *argb, int w, int h, int hot_x, int hot_y);
+// puts back what the cursor covers in buf when it has moved or repaint is
+// about to draw there, before anything is drawn into buf for a frame
+void cursor_erase(cursor_save_t *s, unsigned char *buf, int pitch, const damage_t *repaint, damage_t *touched);
+// draws it at the mouse position unless it is still there, last thing
+// before buf is presented. both add what they change to touched, if given
+void cursor_draw(cursor_save_t *s, unsigned char *buf, int pitch, damage_t *touched);
+void cursor_save_free(cursor_save_t *s);
+// whether there is a cursor to draw over the frame at all
+bool cursor_shown(void);
+// the sprite, for backends that can show it on a cursor plane instead. NULL
+// unless cursor_shown(), gen changes whenever the sprite does
+const uint32_t *cursor_sprite(int *w, int *h, int *hot_x, int *hot_y, uint32_t *gen);
 
 extern int ev_fd;
 
-extern window_t windows[MAX_WINDOWS];
+extern window_t *windows;
+extern int window_slots; // in windows[] and window_geom, used or not
+extern int window_count; // used
 extern unsigned char *screen_buffer;
 extern int fb_fd;
 extern drmModeModeInfo mode;
@@ -0,0 +1,146 @@
+// checks the frame scheduler in src/server/sched.c against a fake presenter
+// with its own clock, whose flips complete only on the vblank after them
+//
+// usage: test_sched
+// prints one line per failed check, exits with 1 if there was any
+
+#include <stdio.h>
+
+#include "wm.h"
+
+#define REFRESH_NS 16666667ull
+#define MS 1000000ull
+
+typedef struct {
+    uint64_t now;
+    uint64_t next_vblank;
+    frame_sched_t *flipping; // the frame queued for the next vblank
+    int presents;
+    int overlapping; // presents while a frame was still queued
+} fake_t;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++; \
+        } \
+    } while (0)
+
+static uint64_t fake_now(void *ctx) {
+    return ((fake_t *)ctx)->now;
+}
+
+static bool fake_present(void *ctx, frame_sched_t *sched) {
+    fake_t *f = ctx;
+    if (f->flipping) f->overlapping++;
+    f->flipping = sched;
+    f->presents++;
+    return true;
+}
+
+static int fake_event_fd(void *ctx) {
+    return -1;
+}
+
+static void fake_dispatch(void *ctx) {
+}
+
+// moves the clock on by ns, completing the queued flip on each vblank passed
+static void fake_advance(fake_t *f, uint64_t ns) {
+    f->now += ns;
+    while (f->next_vblank <= f->now) {
+        if (f->flipping) {
+            frame_sched_t *s = f->flipping;
+            f->flipping = NULL;
+            sched_frame_done(s, f->next_vblank);
+        }
+        f->next_vblank += REFRESH_NS;
+    }
+}
+
+static void setup(fake_t *f, presenter_t *p, frame_sched_t *s) {
+    *f = (fake_t){.now = 1000 * MS, .next_vblank = 1000 * MS + REFRESH_NS};
+    *p = (presenter_t){f, fake_now, fake_present, fake_event_fd, fake_dispatch};
+    sched_init(s, p, REFRESH_NS);
+}
+
+// the server loop in short: present when a repaint is due, sleep till the
+// deadline, or for good when it is SCHED_NEVER
+static void run(fake_t *f, frame_sched_t *s, bool dirty, uint64_t until) {
+    while (f->now < until) {
+        if (sched_repaint_due(s, dirty)) sched_present(s);
+        uint64_t deadline = sched_deadline(s, dirty);
+        uint64_t wake = deadline != SCHED_NEVER && deadline > f->now ? deadline : f->next_vblank;
+        fake_advance(f, (wake < until ? wake : until) - f->now);
+    }
+}
+
+static void test_idle(void) {
+    fake_t f;
+    presenter_t p;
+    frame_sched_t s;
+    setup(&f, &p, &s);
+
+    CHECK(sched_deadline(&s, false) == SCHED_NEVER);
+    CHECK(sched_timeout_ms(&s, false) == -1);
+    CHECK(!sched_repaint_due(&s, false));
+    run(&f, &s, false, f.now + 60 * REFRESH_NS);
+    CHECK(f.presents == 0);
+    CHECK(s.frames_presented == 0);
+}
+
+static void test_one_in_flight(void) {
+    fake_t f;
+    presenter_t p;
+    frame_sched_t s;
+    setup(&f, &p, &s);
+
+    // always dirty: one frame per refresh, never one queued over another
+    int refreshes = 120;
+    run(&f, &s, true, f.now + refreshes * REFRESH_NS);
+    CHECK(f.overlapping == 0);
+    CHECK(f.presents <= refreshes);
+    CHECK(f.presents >= refreshes - 1);
+
+    // nothing is due while the frame is still queued, however dirty
+    if (!s.frame_pending) sched_present(&s);
+    CHECK(s.frame_pending);
+    CHECK(sched_deadline(&s, true) == SCHED_NEVER);
+    CHECK(!sched_repaint_due(&s, true));
+}
+
+static void test_deadline(void) {
+    fake_t f;
+    presenter_t p;
+    frame_sched_t s;
+    setup(&f, &p, &s);
+
+    // idle for longer than a refresh, the first frame goes out right away
+    CHECK(sched_deadline(&s, true) == f.now);
+    CHECK(sched_timeout_ms(&s, true) == 0);
+
+    sched_present(&s);
+    uint64_t vblank = f.next_vblank;
+    fake_advance(&f, vblank - f.now + MS);
+    CHECK(!s.frame_pending);
+    CHECK(s.last_vblank_ns == vblank);
+    CHECK(s.margin_ns == 4 * MS);
+    CHECK(sched_deadline(&s, true) == vblank + REFRESH_NS - s.margin_ns);
+    CHECK(!sched_repaint_due(&s, true));
+
+    // the margin never takes more than half of a short refresh
+    sched_init(&s, &p, 5 * MS);
+    CHECK(s.margin_ns == 5 * MS / 2);
+}
+
+int main(void) {
+    test_idle();
+    test_one_in_flight();
+    test_deadline();
+    if (failures) return 1;
+    printf("sched: all checks passed\n");
+    return 0;
+}